@@ -1,4 +1,6 @@
 #include <iostream>
+#include "../bloom_filter.h"
+#include <vector>
 
 using namespace std;
 
@@ -35,11 +37,19 @@ private:
     // Pointer to the root node of the AVL tree
     Node* root; 
 
+    // Number of nodes in the AVL tree
+    int nodeCount; 
+
+    // Optional filter that answers most searches for absent values without walking the tree
+    BlockedBloomFilter filter; 
+
 public:
     // Constructor to initialize the AVL Tree with an empty root
     AVLTree() {
         // Initially, the tree is empty, so root is set to nullptr
         this->root = nullptr; 
+        // And it has no nodes
+        this->nodeCount = 0; 
     }
 
     // Helper function to get the height of a node (used to calculate balance factors)
@@ -110,6 +120,7 @@ public:
     Node* insertNode(Node* node, int data) {
         // If the node is nullptr, it means we have found an empty spot for the new node
         if (node == nullptr) {
+            nodeCount++; 
             return new Node(data); 
         }
 
@@ -183,12 +194,14 @@ public:
             if (node->left == nullptr) {
                 Node* temp = node->right; 
                 delete node; 
+                nodeCount--; 
                 return temp; 
             } 
             // If the node has no right child, replace it with its left child
             else if (node->right == nullptr) {
                 Node* temp = node->left; 
                 delete node; 
+                nodeCount--; 
                 return temp; 
             }
 
@@ -247,13 +260,127 @@ public:
 
     // Public function to insert a new node into the AVL tree
     void insert(int data) {
+        // Remember the count, to tell whether a node was added (duplicates are not)
+        int countBefore = nodeCount; 
         // Insert the new data into the tree, and update the root pointer
         root = insertNode(root, data); 
+        // Keep the filter up to date, rebuilding it once it is full
+        if (nodeCount > countBefore && filter.isEnabled()) {
+            filter.add(data); 
+            if (filter.needsRebuild()) {
+                rebuildBloomFilter(); 
+            }
+        }
     }
 
     // Public function to delete a node from the AVL tree
     void deleteNode(int data) {
+        // Remember the count, to tell whether a node was removed
+        int countBefore = nodeCount; 
         // Delete the node from the tree, and update the root pointer
         root = deleteNode(root, data); 
+        // Bits cannot be removed from the filter: rebuild it once too many values are gone
+        if (nodeCount < countBefore && filter.isEnabled()) {
+            filter.noteDelete(); 
+            if (filter.needsRebuild()) {
+                rebuildBloomFilter(); 
+            }
+        }
+    }
+
+    // Public function to search for a value in the AVL tree
+    bool search(int data) {
+        // Without a filter, search the tree directly
+        if (!filter.isEnabled()) {
+            return searchNode(root, data); 
+        }
+        // The filter rejects most absent values after reading one cache line
+        if (!filter.mayContain(data)) {
+            filter.recordNegative(false); 
+            return false; 
+        }
+        // Otherwise the tree decides; an absent value here was a false positive
+        bool found = searchNode(root, data); 
+        if (!found) {
+            filter.recordNegative(true); 
+        }
+        return found; 
+    }
+
+    // Helper function to search for a value, walking down from the given node
+    bool searchNode(Node* node, int data) {
+        while (node != nullptr) {
+            // If the current node holds the data, it is found
+            if (node->data == data) {
+                return true; 
+            }
+            // Otherwise continue in the subtree that can hold it
+            node = (data < node->data) ? node->left : node->right; 
+        }
+        // The path ended, so the data is not in the tree
+        return false; 
+    }
+
+    // Public function to put a Bloom filter in front of search, with the given bits
+    // per value (about 10 gives 1% false positives; more bits, fewer false positives)
+    void enableBloomFilter(int bitsPerKey = 10) {
+        // A size of 0 or less turns the filter off
+        if (bitsPerKey <= 0) {
+            disableBloomFilter(); 
+            return; 
+        }
+        filter.reset(bitsPerKey, 0); 
+        filter.resetStatistics(); 
+        rebuildBloomFilter(); 
+    }
+
+    // Public function to remove the Bloom filter and free its memory
+    void disableBloomFilter() {
+        filter.reset(0, 0); 
+    }
+
+    // Public function to get the measured share of searches for absent values that the filter let through
+    double bloomFalsePositiveRate() {
+        return filter.falsePositiveRate(); 
+    }
+
+    // Public function to get the memory used by the Bloom filter in bytes (0 if disabled)
+    size_t bloomMemoryBytes() {
+        return filter.memoryBytes(); 
+    }
+
+    // Helper function to refill the filter from the values in the tree (nothing
+    // to do while it is disabled). It is sized with room for 50% more values,
+    // so rebuilds for growth are O(1) amortized.
+    void rebuildBloomFilter() {
+        // A disabled filter has no bits to fill
+        if (!filter.isEnabled()) {
+            return;
+        }
+        filter.reset(filter.getBitsPerKey(), nodeCount + nodeCount / 2); 
+        addToFilter(root); 
+    }
+
+    // Helper function to add every value of a subtree to the filter (iterative, with an explicit stack)
+    void addToFilter(Node* node) {
+        // An empty subtree adds nothing
+        if (node == nullptr) {
+            return; 
+        }
+        // Stack of subtrees still to add (at most about 2 * height entries)
+        vector<Node*> pending; 
+        pending.push_back(node); 
+        while (!pending.empty()) {
+            Node* current = pending.back(); 
+            pending.pop_back(); 
+            filter.add(current->data); 
+            // Add both children's subtrees later
+            if (current->left != nullptr) {
+                pending.push_back(current->left); 
+            }
+            if (current->right != nullptr) {
+                pending.push_back(current->right); 
+            }
+        }
     }
 };
@@ -1,5 +1,18 @@
 #include <iostream>
+#include "../bloom_filter.h"
+#include <cmath>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <new>
 #include <queue>
+#include <utility>
+#include <vector>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
 
 using namespace std;
 
@@ -8,6 +21,9 @@ class Node {
 public:
     // Data stored in the node
     int data; 
+    // Number of nodes in the subtree rooted at this node (itself included).
+    // It fills the padding after data, so the node stays 24 bytes on 64-bit targets.
+    int size; 
     // Pointer to the left child of the node
     Node* left; 
     // Pointer to the right child of the node
@@ -17,67 +33,357 @@ public:
     Node(int data) {
         // Set the data of the node
         this->data = data; 
+        // A new node is a subtree of one
+        this->size = 1; 
         // Initialize left and right pointers to nullptr (no children)
         this->left = nullptr; 
         this->right = nullptr; 
     }
 };
 
+// Define a FrozenBSTree class: an immutable copy of a BSTree for read-only
+// lookups, created by BSTree::freeze(). The values are stored in one array in
+// Eytzinger (breadth-first) order: the root at index 1 and the children of
+// index k at 2k and 2k + 1. A search is a loop of array reads with no
+// unpredictable branches, and the 16 possible nodes four levels further down
+// share one cache line, so they can be prefetched while the current levels
+// are compared.
+class FrozenBSTree {
+private:
+    // Values in Eytzinger order at indices 1..n (index 0 is unused); 64-byte
+    // aligned so the 16 descendants 16k..16k+15 fill exactly one cache line
+    int* values; 
+    // Number of values
+    int n; 
+    // Number of levels of the implicit tree
+    int levels; 
+
+    // Helper function to fill the array: an in-order walk of the implicit
+    // tree visits the indices in sorted order. The recursion is O(log n) deep.
+    void fill(const vector<int>& sorted, int& next, int k) {
+        // Indices beyond n are not part of the tree
+        if (k > n) {
+            return; 
+        }
+        // Left subtree, then the node, then the right subtree
+        fill(sorted, next, 2 * k); 
+        values[k] = sorted[next++]; 
+        fill(sorted, next, 2 * k + 1); 
+    }
+
+    // Helper function to find the index of the first value >= x (0 if there is none)
+    int lowerBoundIndex(int x) const {
+        int k = 1; 
+        while (k <= n) {
+            // Prefetch the cache line with the 16 descendants four levels down
+            __builtin_prefetch(values + 16 * k); 
+            // Branchless step: go right if the value is too small, else left
+            k = 2 * k + (values[k] < x); 
+        }
+        // The last left turn was at the answer: drop the trailing right turns and that turn
+        return k >> (__builtin_ctz(~k) + 1); 
+    }
+
+public:
+    // Constructor to build the array from values in ascending order
+    explicit FrozenBSTree(const vector<int>& sorted) {
+        n = (int)sorted.size(); 
+        // One aligned allocation for indices 0..n
+        values = static_cast<int*>(::operator new((n + 1) * sizeof(int), align_val_t(64))); 
+        values[0] = 0; 
+        int next = 0; 
+        fill(sorted, next, 1); 
+        // Count the levels of the implicit tree
+        levels = 0; 
+        for (int k = n; k > 0; k /= 2) {
+            levels++; 
+        }
+    }
+
+    // The array is owned by one object only: moving is allowed, copying is not
+    FrozenBSTree(FrozenBSTree&& other) {
+        values = other.values; 
+        n = other.n; 
+        levels = other.levels; 
+        other.values = nullptr; 
+        other.n = 0; 
+        other.levels = 0; 
+    }
+    FrozenBSTree(const FrozenBSTree&) = delete; 
+    FrozenBSTree& operator=(const FrozenBSTree&) = delete; 
+
+    // Destructor to free the array
+    ~FrozenBSTree() {
+        ::operator delete(values, align_val_t(64)); 
+    }
+
+    // Function to get the number of values
+    int size() const {
+        return n; 
+    }
+
+    // Function to search for a value
+    bool search(int data) const {
+        int k = lowerBoundIndex(data); 
+        // Found if the first value >= data is data itself
+        return k != 0 && values[k] == data; 
+    }
+
+    // Function to compute the depth of a value in the frozen layout (-1 if not found).
+    // The frozen tree is balanced, so this can differ from the depth in the BSTree.
+    int depth(int data) const {
+        int currentDepth = 0; 
+        // Follow the search path down to the first node holding the data
+        for (int k = 1; k <= n; k = 2 * k + (data > values[k])) {
+            if (values[k] == data) {
+                return currentDepth; 
+            }
+            currentDepth++; 
+        }
+        // The data is not in the tree
+        return -1; 
+    }
+
+    // Function to search for 8 values at once; out[i] tells whether keys[i] was found.
+    // With AVX2 the 8 searches run in the lanes of one vector, otherwise one after another.
+    void searchBatch8(const int* keys, bool* out) const {
+#ifdef __AVX2__
+        __m256i x = _mm256_loadu_si256((const __m256i*)keys); 
+        __m256i count = _mm256_set1_epi32(n); 
+        __m256i one = _mm256_set1_epi32(1); 
+        __m256i k = one; 
+        // Every lane takes the same number of steps: a lane that has left the
+        // tree keeps going right, which the final shift removes again
+        for (int level = 0; level < levels; level++) {
+            // Read values[k] only in lanes still inside the tree
+            __m256i inside = _mm256_cmpgt_epi32(_mm256_add_epi32(count, one), k); 
+            __m256i node = _mm256_mask_i32gather_epi32(_mm256_setzero_si256(), values, k, inside, 4); 
+            // Go right if outside the tree or if the value is too small
+            __m256i right = _mm256_or_si256(_mm256_andnot_si256(inside, _mm256_set1_epi32(-1)), _mm256_cmpgt_epi32(x, node)); 
+            k = _mm256_sub_epi32(_mm256_add_epi32(k, k), right); 
+        }
+        // Finish each lane like lowerBoundIndex does
+        alignas(32) int lanes[8]; 
+        _mm256_store_si256((__m256i*)lanes, k); 
+        for (int i = 0; i < 8; i++) {
+            int index = lanes[i] >> (__builtin_ctz(~lanes[i]) + 1); 
+            out[i] = index != 0 && values[index] == keys[i]; 
+        }
+#else
+        for (int i = 0; i < 8; i++) {
+            out[i] = search(keys[i]); 
+        }
+#endif
+    }
+};
+
 // Define a BSTree class
 class BSTree {
 private:
     // Pointer to the root node of the tree
     Node* root; 
+    // Number of nodes in the tree
+    int nodeCount; 
+    // Depth of the node created by the most recent insert
+    int lastInsertDepth; 
+    // Nodes from the root down to the node created by the most recent insert
+    vector<Node*> insertPath; 
+    // Contiguous block holding the nodes created by buildFromSorted (or nullptr)
+    Node* block; 
+    // Number of nodes in that block
+    int blockNodes; 
+    // Optional filter that answers most searches for absent values without walking the tree
+    BlockedBloomFilter filter; 
+
+    // The tree is rebalanced once an insert makes height() exceed this factor times log2(n)
+    static constexpr double REBALANCE_FACTOR = 2.0; 
+    // Trees smaller than this are never rebalanced automatically
+    static const int REBALANCE_MIN_NODES = 16; 
+    // Number of searches searchBatch keeps in flight at the same time
+    static const int BATCH_LANES = 16; 
+    // Subtrees smaller than this are never split across threads by the parallel functions
+    static const int PARALLEL_CUTOFF = 1 << 16; 
 
 public:
     // Constructor to initialize the BST
     BSTree() {
         // Initialize the root to null, indicating an empty tree
         this->root = nullptr; 
+        // The tree starts without nodes
+        this->nodeCount = 0; 
+        this->lastInsertDepth = 0; 
+        // No bulk-loaded nodes yet
+        this->block = nullptr; 
+        this->blockNodes = 0; 
     }
 
     // Destructor to free memory used by the tree
     ~BSTree() {
-        // When the BST object is destroyed, delete the entire tree starting from the root
+        // When the BST object is destroyed, delete the entire tree and the node block;
+        // the filter frees its own bit array
+        freeNodes(); 
+    }
+
+    // Remove all values and free all memory of the tree
+    void clear() {
+        freeNodes(); 
+        // The filter forgets all values too: an empty tree needs only the smallest filter
+        if (filter.isEnabled()) {
+            filter.reset(filter.getBitsPerKey(), 0); 
+        }
+    }
+
+    // Helper function to delete every node and the node block, leaving the filter alone
+    void freeNodes() {
+        // Delete the nodes that were allocated one by one
         deleteTree(root); 
+        root = nullptr; 
+        nodeCount = 0; 
+        // Then free the bulk-loaded nodes all at once
+        ::operator delete(block); 
+        block = nullptr; 
+        blockNodes = 0; 
     }
 
-    // Delete tree helper function (recursive)
+    // Free a single node. A node inside the block is not freed here: an erased
+    // block node keeps its memory until the tree is cleared or destroyed, when
+    // the whole block is freed at once.
+    void destroyNode(Node* node) {
+        // Pointers into different allocations may only be ordered with std::less
+        less<Node*> before; 
+        // Only nodes created on their own can be deleted one by one
+        if (before(node, block) || !before(node, block + blockNodes)) {
+            delete node; 
+        }
+    }
+
+    // Delete tree helper function (iterative, O(1) extra space)
     void deleteTree(Node* node) {
-        // Base case: If the node is null, return (no node to delete)
-        if (node == nullptr) {
-            return;
+        // Keep going until every node of the subtree is deleted
+        while (node != nullptr) {
+            if (node->left != nullptr) {
+                // Rotate the left child up, so the left side shrinks without recursion
+                Node* leftChild = node->left; 
+                node->left = leftChild->right; 
+                leftChild->right = node; 
+                node = leftChild; 
+            } else {
+                // No left child: delete the node and continue with its right subtree
+                Node* rightChild = node->right; 
+                destroyNode(node); 
+                node = rightChild; 
+            }
         }
-        // Recursively delete the left subtree
-        deleteTree(node->left); 
-        // Recursively delete the right subtree
-        deleteTree(node->right); 
-        // After the left and right subtrees are deleted, delete the current node
-        delete node; 
     }
 
     // Insert a node into the BST
     void insert(int value) {
         // Start the insertion process from the root node
         root = insert(root, value); 
+        // Keep the filter up to date, rebuilding it once it is full
+        if (filter.isEnabled()) {
+            filter.add(value); 
+            if (filter.needsRebuild()) {
+                rebuildBloomFilter(); 
+            }
+        }
+        // Rebalance once the new node made the tree too tall (height = depth + 1)
+        if (nodeCount >= REBALANCE_MIN_NODES && lastInsertDepth + 1 > REBALANCE_FACTOR * log2((double)nodeCount)) {
+            rebalanceAlongInsertPath(); 
+        }
+    }
+
+    // Rebalance after an insert that made the tree too tall. Rebuilding the
+    // whole tree each time would cost O(n) every few inserts on sorted input,
+    // so only the subtree of the lowest unbalanced ancestor of the new node
+    // (its "scapegoat") is rebuilt, which keeps inserts O(log n) amortized.
+    // Such an ancestor always exists while height() > REBALANCE_FACTOR * log2(n).
+    void rebalanceAlongInsertPath() {
+        // A child holding more than this fraction of its parent's subtree is too heavy
+        double alpha = pow(2.0, -1.0 / REBALANCE_FACTOR); 
+        // Walk up from the new node, keeping the size of the subtree we came from
+        int childSize = 1; 
+        for (int i = (int)insertPath.size() - 2; i >= 0; i--) {
+            Node* node = insertPath[i]; 
+            Node* child = insertPath[i + 1]; 
+            // Size of this subtree: the child's side, the node itself and the other side
+            Node* sibling = (node->left == child) ? node->right : node->left; 
+            int size = childSize + 1 + sizeOf(sibling); 
+            // The first too heavy ancestor is the scapegoat: rebuild its subtree
+            if (childSize > alpha * size) {
+                Node* rebuilt = rebuildSubtree(node); 
+                // Hang the rebuilt subtree where the old one was
+                if (i == 0) {
+                    root = rebuilt; 
+                } else if (insertPath[i - 1]->left == node) {
+                    insertPath[i - 1]->left = rebuilt; 
+                } else {
+                    insertPath[i - 1]->right = rebuilt; 
+                }
+                return; 
+            }
+            // Continue one level up
+            childSize = size; 
+        }
+        // Not reached for a consistent tree, but rebuilding everything is always correct
+        rebalance(); 
     }
 
-    // Insert node helper function (recursive)
+    // Number of nodes in a subtree (0 for an empty one)
+    static int sizeOf(Node* node) {
+        return (node == nullptr) ? 0 : node->size; 
+    }
+
+    // Recompute a node's subtree size from its children
+    static void updateSize(Node* node) {
+        node->size = 1 + sizeOf(node->left) + sizeOf(node->right); 
+    }
+
+    // Insert node helper function (iterative); returns the root of the subtree
     Node* insert(Node* node, int value) {
-        // Base case: If the node is null, we've found the position to insert the new node
+        // The new node is created in every case
+        Node* newNode = new Node(value); 
+        nodeCount++; 
+        // Start recording the path to the new node
+        insertPath.clear(); 
+        // If the subtree is empty, the new node is its root
         if (node == nullptr) {
-            // Create and return a new node with the given value
-            return new Node(value); 
+            lastInsertDepth = 0; 
+            insertPath.push_back(newNode); 
+            return newNode; 
         }
-
-        // If the value is smaller than the current node's data, insert in the left subtree
-        if (value < node->data) { 
-            node->left = insert(node->left, value); 
-        } else { 
-            // If the value is greater or equal to the current node's data, insert in the right subtree
-            node->right = insert(node->right, value); 
+        // Walk down to the parent of the free position
+        Node* current = node; 
+        int depth = 1; 
+        while (true) {
+            // Record every node on the way down
+            insertPath.push_back(current); 
+            // The new node ends up in this node's subtree
+            current->size++; 
+            // If the value is smaller than the current node's data, go to the left subtree
+            if (value < current->data) { 
+                if (current->left == nullptr) {
+                    // Attach the new node as the left child
+                    current->left = newNode; 
+                    break; 
+                }
+                current = current->left; 
+            } else { 
+                // If the value is greater or equal to the current node's data, go to the right subtree
+                if (current->right == nullptr) {
+                    // Attach the new node as the right child
+                    current->right = newNode; 
+                    break; 
+                }
+                current = current->right; 
+            }
+            // One level deeper
+            depth++; 
         }
-        // Return the unchanged node (because we might be inserting deeper in the tree)
+        // Remember how deep the new node ended up
+        lastInsertDepth = depth; 
+        insertPath.push_back(newNode); 
+        // Return the unchanged subtree root
         return node; 
     }
 
@@ -87,18 +393,29 @@ public:
         preorderTraversalNode(root); 
     }
 
-    // Preorder traversal helper function (recursive)
+    // Preorder traversal helper function (iterative, with an explicit stack)
     void preorderTraversalNode(Node* node) {
-        // Base case: If the node is null, do nothing
+        // If the node is null, do nothing
         if (node == nullptr) {
             return;
         }
-        // Print the current node's data
-        cout << node->data << " "; 
-        // Recursively traverse the left subtree
-        preorderTraversalNode(node->left); 
-        // Recursively traverse the right subtree
-        preorderTraversalNode(node->right); 
+        // Stack of subtrees still to visit
+        vector<Node*> pending; 
+        pending.push_back(node); 
+        while (!pending.empty()) {
+            // Take the next subtree root
+            Node* current = pending.back(); 
+            pending.pop_back(); 
+            // Print the current node's data
+            cout << current->data << " "; 
+            // Push the right subtree first so the left one is visited first
+            if (current->right != nullptr) {
+                pending.push_back(current->right); 
+            }
+            if (current->left != nullptr) {
+                pending.push_back(current->left); 
+            }
+        }
     }
 
     // Level order traversal of the tree (Breadth-first)
@@ -136,14 +453,100 @@ public:
         return heightNode(root); 
     }
 
-    // Helper function to calculate the height of a node (subtree height)
+    // Helper function to calculate the height of a node (subtree height), level by level
     int heightNode(Node* node) {
-        // Base case: If the node is null, its height is 0 (no height for an empty node)
+        // If the node is null, its height is 0 (no height for an empty node)
         if (node == nullptr) {
             return 0;
         }
-        // The height of the node is 1 plus the maximum of the heights of its left and right subtrees
-        return 1 + max(heightNode(node->left), heightNode(node->right)); 
+        // Count the levels of a breadth-first traversal
+        int height = 0; 
+        queue<Node*> q; 
+        q.push(node); 
+        while (!q.empty()) {
+            // Every node currently in the queue is on the same level
+            int levelSize = q.size(); 
+            height++; 
+            // Replace the level by the next one
+            for (int i = 0; i < levelSize; i++) {
+                Node* current = q.front(); 
+                q.pop(); 
+                if (current->left != nullptr) {
+                    q.push(current->left); 
+                }
+                if (current->right != nullptr) {
+                    q.push(current->right); 
+                }
+            }
+        }
+        return height; 
+    }
+
+    // Function to compute the height of the tree with up to the given number of threads
+    int heightParallel(int threads) {
+        return heightParallelNode(root, splitLevels(threads)); 
+    }
+
+    // Helper function to compute a subtree height, splitting it across threads for
+    // the given number of levels; small subtrees are done sequentially
+    int heightParallelNode(Node* node, int levels) {
+        // Stop splitting when out of levels or when the subtree is too small to pay for a thread
+        if (levels <= 0 || sizeOf(node) < PARALLEL_CUTOFF) {
+            return heightNode(node); 
+        }
+        // The left subtree on another thread, the right one on this thread
+        future<int> left = async(launch::async, &BSTree::heightParallelNode, this, node->left, levels - 1); 
+        int right = heightParallelNode(node->right, levels - 1); 
+        return 1 + max(left.get(), right); 
+    }
+
+    // Function to write all values in ascending order into out, which must hold
+    // size() values, using up to the given number of threads. The subtree sizes
+    // give every subtree its own range of out, so threads never share output.
+    void inorderParallel(int* out, int threads) {
+        inorderParallelNode(root, out, splitLevels(threads)); 
+    }
+
+    // Helper function to write a subtree in order starting at out, splitting it
+    // across threads for the given number of levels
+    void inorderParallelNode(Node* node, int* out, int levels) {
+        // Stop splitting when out of levels or when the subtree is too small to pay for a thread
+        if (levels <= 0 || sizeOf(node) < PARALLEL_CUTOFF) {
+            inorderInto(node, out); 
+            return; 
+        }
+        // The left subtree fills the front, then the node, then the right subtree
+        int leftSize = sizeOf(node->left); 
+        future<void> left = async(launch::async, &BSTree::inorderParallelNode, this, node->left, out, levels - 1); 
+        out[leftSize] = node->data; 
+        inorderParallelNode(node->right, out + leftSize + 1, levels - 1); 
+        left.get(); 
+    }
+
+    // Helper function to write a subtree in order starting at out (sequential, explicit stack)
+    void inorderInto(Node* node, int* out) {
+        vector<Node*> pending; 
+        while (node != nullptr || !pending.empty()) {
+            // Go down to the leftmost node not visited yet
+            while (node != nullptr) {
+                pending.push_back(node); 
+                node = node->left; 
+            }
+            // Write it, then continue with its right subtree
+            node = pending.back(); 
+            pending.pop_back(); 
+            *out++ = node->data; 
+            node = node->right; 
+        }
+    }
+
+    // Helper function to get how many tree levels to split so that about the given number of threads is used
+    static int splitLevels(int threads) {
+        int levels = 0; 
+        while ((1 << levels) < threads) {
+            levels++; 
+        }
+        return levels; 
     }
 
     // Function to compute the depth of a node given its data value
@@ -152,95 +555,218 @@ public:
         return depthNode(root, data, 0); 
     }
 
-    // Helper function to calculate the depth of a node recursively
+    // Helper function to calculate the depth of a node iteratively
     int depthNode(Node* node, int data, int currentDepth) {
-        // Base case: If the node is null, the depth doesn't exist (-1)
-        if (node == nullptr) {
-            return -1; 
-        }
-        // If the current node's data matches the search data, return the current depth
-        if (node->data == data) {
-            return currentDepth; 
-        }
-        // Recursively search the left subtree and increment the depth
-        int leftDepth = depthNode(node->left, data, currentDepth + 1); 
-        // If the depth is found in the left subtree, return it
-        if (leftDepth != -1) {
-            return leftDepth; 
+        // Follow the search path: every copy of data lies on it, the shallowest first
+        while (node != nullptr) {
+            // If the current node's data matches the search data, return the current depth
+            if (node->data == data) {
+                return currentDepth; 
+            }
+            // Go to the subtree that can contain the data and increment the depth
+            node = (data < node->data) ? node->left : node->right; 
+            currentDepth++; 
         }
-        // Recursively search the right subtree and increment the depth
-        return depthNode(node->right, data, currentDepth + 1); 
+        // The data is not in the tree, so the depth doesn't exist (-1)
+        return -1; 
     }
 
     // Function to search for a node with a specific data value
     bool search(int data) {
-        // Call the recursive function to search for the node
-        return searchNode(root, data); 
+        // Without a filter, search the tree directly
+        if (!filter.isEnabled()) {
+            return searchNode(root, data); 
+        }
+        // The filter rejects most absent values after reading one cache line
+        if (!filter.mayContain(data)) {
+            filter.recordNegative(false); 
+            return false; 
+        }
+        // Otherwise the tree decides; an absent value here was a false positive
+        bool found = searchNode(root, data); 
+        if (!found) {
+            filter.recordNegative(true); 
+        }
+        return found; 
+    }
+
+    // Function to put a Bloom filter in front of search, with the given bits per
+    // value (about 10 gives 1% false positives; more bits, fewer false positives)
+    void enableBloomFilter(int bitsPerKey = 10) {
+        // A size of 0 or less turns the filter off
+        if (bitsPerKey <= 0) {
+            disableBloomFilter(); 
+            return; 
+        }
+        filter.reset(bitsPerKey, 0); 
+        filter.resetStatistics(); 
+        rebuildBloomFilter(); 
+    }
+
+    // Function to remove the Bloom filter and free its memory
+    void disableBloomFilter() {
+        filter.reset(0, 0); 
+    }
+
+    // Function to get the measured share of searches for absent values that the filter let through
+    double bloomFalsePositiveRate() {
+        return filter.falsePositiveRate(); 
+    }
+
+    // Function to get the memory used by the Bloom filter in bytes (0 if disabled)
+    size_t bloomMemoryBytes() {
+        return filter.memoryBytes(); 
     }
 
-    // Helper function to search for a node recursively
+    // Helper function to refill the filter from the values in the tree (nothing
+    // to do while it is disabled). It is sized with room for 50% more values,
+    // so rebuilds for growth are O(1) amortized.
+    void rebuildBloomFilter() {
+        // A disabled filter has no bits to fill
+        if (!filter.isEnabled()) {
+            return;
+        }
+        filter.reset(filter.getBitsPerKey(), nodeCount + nodeCount / 2); 
+        for (Iterator it = begin(); it != end(); ++it) {
+            filter.add(*it); 
+        }
+    }
+
+    // Helper function to search for a node iteratively
     bool searchNode(Node* node, int data) {
-        // Base case: If the node is null, the data is not found
-        if (node == nullptr) {
-            return false; 
+        // Walk down until the data is found or the path ends
+        while (node != nullptr) {
+            // If the current node contains the data, return true (data found)
+            if (node->data == data) {
+                return true; 
+            }
+            // If the data is smaller, continue in the left subtree, otherwise in the right subtree
+            node = (data < node->data) ? node->left : node->right; 
         }
-        // If the current node contains the data, return true (data found)
-        if (node->data == data) {
-            return true; 
+        // The path ended, so the data is not found
+        return false; 
+    }
+
+    // Function to search for many values at once; out[i] tells whether keys[i] was found.
+    // A single search waits for one cache miss per level. Here up to
+    // BATCH_LANES searches are in flight: each one prefetches its next node
+    // and then yields to the others, so their cache misses overlap. Every
+    // search is a small state machine (asynchronous memory access chaining).
+    void searchBatch(const int* keys, int count, bool* out) {
+        // State of one in-flight search
+        struct Lane {
+            Node* node;   // Node to look at next (nullptr once the path ended)
+            int index;    // Position of the key in keys (-1 if the lane is idle)
+        };
+        Lane lanes[BATCH_LANES]; 
+        int nextKey = 0; 
+        int active = 0; 
+        // Start the first searches, each with a prefetch of the root
+        for (int i = 0; i < BATCH_LANES; i++) {
+            if (nextKey < count) {
+                lanes[i].node = root; 
+                lanes[i].index = nextKey++; 
+                __builtin_prefetch(root); 
+                active++; 
+            } else {
+                lanes[i].index = -1; 
+            }
         }
-        // If the data is smaller, search in the left subtree
-        if (data < node->data) {
-            return searchNode(node->left, data); 
-        } else { 
-            // If the data is greater, search in the right subtree
-            return searchNode(node->right, data); 
+        // Round robin over the lanes until every search has finished
+        while (active > 0) {
+            for (int i = 0; i < BATCH_LANES; i++) {
+                Lane& lane = lanes[i]; 
+                // Skip idle lanes
+                if (lane.index < 0) {
+                    continue; 
+                }
+                int data = keys[lane.index]; 
+                Node* node = lane.node; 
+                // The search ends when the path ends or the node holds the data
+                if (node == nullptr || node->data == data) {
+                    out[lane.index] = (node != nullptr); 
+                    // Reuse the lane for the next key, or make it idle
+                    if (nextKey < count) {
+                        lane.node = root; 
+                        lane.index = nextKey++; 
+                    } else {
+                        lane.index = -1; 
+                        active--; 
+                    }
+                    continue; 
+                }
+                // One step down, then prefetch the child and move on to the next lane
+                lane.node = (data < node->data) ? node->left : node->right; 
+                __builtin_prefetch(lane.node); 
+            }
         }
     }
 
     // Function to delete a node with a specific data value
     void deleteNode(int data) {
+        // Remember the count, to tell whether a node was removed
+        int countBefore = nodeCount; 
         // Call the recursive function to delete the node from the tree
         root = deleteNodeNode(root, data); 
+        // Bits cannot be removed from the filter: rebuild it once too many values are gone
+        if (nodeCount < countBefore && filter.isEnabled()) {
+            filter.noteDelete(); 
+            if (filter.needsRebuild()) {
+                rebuildBloomFilter(); 
+            }
+        }
     }
 
-    // Helper function to delete a node recursively
+    // Helper function to delete a node iteratively; returns the root of the subtree
     Node* deleteNodeNode(Node* node, int data) {
-        // Base case: If the node is null, return it (no deletion)
-        if (node == nullptr) {
+        // Walk down to the node holding the data, remembering its parent
+        Node* parent = nullptr; 
+        Node* current = node; 
+        while (current != nullptr && current->data != data) {
+            parent = current; 
+            // If the data is smaller, continue in the left subtree, otherwise in the right subtree
+            current = (data < current->data) ? current->left : current->right; 
+        }
+        // If the data is not in the tree, return the subtree unchanged (no deletion)
+        if (current == nullptr) {
             return node; 
         }
-        // If the data is smaller than the current node's data, recurse on the left subtree
-        if (data < node->data) {
-            node->left = deleteNodeNode(node->left, data); 
-        } else if (data > node->data) {
-            // If the data is larger than the current node's data, recurse on the right subtree
-            node->right = deleteNodeNode(node->right, data); 
-        } else { 
-            // Case 1: If the node has only one child or no child
-            if (node->left == nullptr) {
-                // Store the pointer to the right child temporarily
-                Node* temp = node->right;
-                // Delete the current node
-                delete node;
-                // Return the right child (it will replace the current node)
-                return temp; 
-            } else if (node->right == nullptr) {
-                // Store the pointer to the left child temporarily
-                Node* temp = node->left;
-                // Delete the current node
-                delete node;
-                // Return the left child (it will replace the current node)
-                return temp; 
+        // The data exists, so every subtree on the path to it loses one node
+        for (Node* ancestor = node; ancestor != current; ancestor = (data < ancestor->data) ? ancestor->left : ancestor->right) {
+            ancestor->size--; 
+        }
+        // Case 2: If the node has two children
+        if (current->left != nullptr && current->right != nullptr) {
+            // Find the inorder successor (minimum of the right subtree) and its parent;
+            // the nodes passed on the way lose the successor
+            current->size--; 
+            Node* successorParent = current; 
+            Node* successor = current->right; 
+            while (successor->left != nullptr) {
+                successor->size--; 
+                successorParent = successor; 
+                successor = successor->left; 
             }
-            // Case 2: If the node has two children
-            // Find the node with the minimum value in the right subtree (inorder successor)
-            Node* temp = minValueNode(node->right); 
             // Copy the inorder successor's data to the current node
-            node->data = temp->data; 
-            // Delete the inorder successor (recursively delete the node)
-            node->right = deleteNodeNode(node->right, temp->data); 
+            current->data = successor->data; 
+            // The successor (which has no left child) is the node to remove now
+            parent = successorParent; 
+            current = successor; 
         }
-        // Return the updated node (after deletion)
+        // Case 1: The node has only one child or no child; that child replaces it
+        Node* child = (current->left != nullptr) ? current->left : current->right; 
+        if (parent == nullptr) {
+            // The removed node was the subtree root
+            node = child; 
+        } else if (parent->left == current) {
+            parent->left = child; 
+        } else {
+            parent->right = child; 
+        }
+        // Delete the removed node
+        destroyNode(current); 
+        nodeCount--; 
+        // Return the updated subtree root (after deletion)
         return node; 
     }
 
@@ -254,4 +780,335 @@ public:
         // Return the leftmost node (node with the minimum value)
         return current; 
     }
+
+    // Create an immutable snapshot for fast read-only lookups (O(n))
+    FrozenBSTree freeze() {
+        // Collect the values in ascending order
+        vector<int> sorted; 
+        sorted.reserve(size()); 
+        for (Iterator it = begin(); it != end(); ++it) {
+            sorted.push_back(*it); 
+        }
+        return FrozenBSTree(sorted); 
+    }
+
+    // Replace the contents of the tree by a perfectly balanced tree of the given
+    // values, which must be in ascending order. Runs in O(n) and allocates all
+    // nodes in one contiguous block, in sorted order. Block nodes that are
+    // deleted later keep their memory until the tree is cleared or destroyed.
+    void buildFromSorted(const vector<int>& values) {
+        // If the values are not sorted, print a message and keep the tree unchanged
+        if (!is_sorted(values.begin(), values.end())) {
+            cout << "Values are not sorted\n"; 
+            return; 
+        }
+        // Drop the old tree and its memory (the filter is refilled once, after the load)
+        freeNodes(); 
+        // An empty range leaves an empty tree
+        if (!values.empty()) {
+            // One raw allocation large enough for every node
+            block = static_cast<Node*>(::operator new(values.size() * sizeof(Node))); 
+            blockNodes = (int)values.size(); 
+            // Construct the nodes in place, in sorted order
+            for (int i = 0; i < blockNodes; i++) {
+                new (&block[i]) Node(values[i]); 
+            }
+            // Link them into a balanced tree
+            root = linkBalanced(0, blockNodes); 
+            nodeCount = blockNodes; 
+        }
+        // Refill the filter with the new values
+        if (filter.isEnabled()) {
+            rebuildBloomFilter(); 
+        }
+    }
+
+    // Same as buildFromSorted, but for values in any order: they are sorted first (O(n log n))
+    void buildFromUnsorted(vector<int> values) {
+        sort(values.begin(), values.end()); 
+        buildFromSorted(values); 
+    }
+
+    // Helper function to link the block nodes [lo, hi) into a balanced subtree; returns its root.
+    // The recursion is only O(log n) deep, because both halves differ by at most one node.
+    Node* linkBalanced(int lo, int hi) {
+        // An empty range is an empty subtree
+        if (lo >= hi) {
+            return nullptr; 
+        }
+        // The middle node is the root, the halves on either side are its subtrees
+        int mid = lo + (hi - lo) / 2; 
+        Node* node = &block[mid]; 
+        node->left = linkBalanced(lo, mid); 
+        node->right = linkBalanced(mid + 1, hi); 
+        node->size = hi - lo; 
+        return node; 
+    }
+
+    // Function to get the number of nodes in the tree
+    int size() {
+        return sizeOf(root); 
+    }
+
+    // Function to get the k-th smallest value (k = 1 is the minimum) in O(height)
+    int select(int k) {
+        // If k is outside 1..size(), print a message and return
+        if (k < 1 || k > sizeOf(root)) {
+            cout << "Rank out of bounds\n"; 
+            return -1; 
+        }
+        Node* current = root; 
+        while (true) {
+            // Nodes in the left subtree come before the current node
+            int leftSize = sizeOf(current->left); 
+            if (k <= leftSize) {
+                // The k-th value is in the left subtree
+                current = current->left; 
+            } else if (k == leftSize + 1) {
+                // The current node is the k-th value
+                return current->data; 
+            } else {
+                // Skip the left subtree and the current node, then continue on the right
+                k -= leftSize + 1; 
+                current = current->right; 
+            }
+        }
+    }
+
+    // Function to count the values smaller than x in O(height)
+    int rank(int x) {
+        return countBelow(x); 
+    }
+
+    // Function to count the values in the half-open range [lo, hi) in O(height);
+    // the same range forEachInRange visits
+    int countInRange(int lo, int hi) {
+        // An empty range holds no values
+        if (lo >= hi) {
+            return 0; 
+        }
+        // Values < hi minus values < lo
+        return countBelow(hi) - countBelow(lo); 
+    }
+
+    // Helper function to count the values smaller than x
+    int countBelow(int x) {
+        int count = 0; 
+        Node* current = root; 
+        while (current != nullptr) {
+            if (current->data < x) {
+                // The current node and its whole left subtree are counted; continue on the right
+                count += sizeOf(current->left) + 1; 
+                current = current->right; 
+            } else {
+                // Everything from here on the right is too large; continue on the left
+                current = current->left; 
+            }
+        }
+        return count; 
+    }
+
+    // In-order iterator: visits the values in ascending order. It keeps the
+    // nodes still to be visited on a small explicit stack (at most height()
+    // entries), so the nodes need no parent pointers. Any insert, delete or
+    // rebalance invalidates all iterators.
+    class Iterator {
+    public:
+        // Iterator traits, so the iterator works with STL algorithms
+        typedef forward_iterator_tag iterator_category; 
+        typedef int value_type; 
+        typedef ptrdiff_t difference_type; 
+        typedef const int* pointer; 
+        typedef const int& reference; 
+
+        // Constructor to create the end iterator
+        Iterator() {
+        }
+
+        // Access the current value
+        reference operator*() const {
+            return pending.back()->data; 
+        }
+        pointer operator->() const {
+            return &pending.back()->data; 
+        }
+
+        // Move to the next value (prefix)
+        Iterator& operator++() {
+            // The current node is done; its successor is the leftmost node of its
+            // right subtree, or else the closest ancestor still on the stack
+            Node* current = pending.back(); 
+            pending.pop_back(); 
+            pushLeftPath(current->right); 
+            return *this; 
+        }
+
+        // Move to the next value (postfix)
+        Iterator operator++(int) {
+            Iterator previous = *this; 
+            ++(*this); 
+            return previous; 
+        }
+
+        // Two iterators are equal if they are at the same node (or both at the end)
+        bool operator==(const Iterator& other) const {
+            Node* mine = pending.empty() ? nullptr : pending.back(); 
+            Node* theirs = other.pending.empty() ? nullptr : other.pending.back(); 
+            return mine == theirs; 
+        }
+        bool operator!=(const Iterator& other) const {
+            return !(*this == other); 
+        }
+
+    private:
+        friend class BSTree; 
+        // Top: the current node; below it: the ancestors still to be visited
+        vector<Node*> pending; 
+
+        // Push a node and all its left descendants (the next values in order)
+        void pushLeftPath(Node* node) {
+            while (node != nullptr) {
+                pending.push_back(node); 
+                node = node->left; 
+            }
+        }
+    };
+
+    // Iterator at the smallest value
+    Iterator begin() {
+        Iterator it; 
+        it.pushLeftPath(root); 
+        return it; 
+    }
+
+    // Iterator past the largest value
+    Iterator end() {
+        return Iterator(); 
+    }
+
+    // Iterator at the first value >= x (end() if there is none), in O(height)
+    Iterator lowerBound(int x) {
+        return boundIterator(x, false); 
+    }
+
+    // Iterator at the first value > x (end() if there is none), in O(height)
+    Iterator upperBound(int x) {
+        return boundIterator(x, true); 
+    }
+
+    // Helper function to find the first value >= x (or > x, if strict)
+    Iterator boundIterator(int x, bool strict) {
+        Iterator it; 
+        Node* current = root; 
+        while (current != nullptr) {
+            if (current->data > x || (!strict && current->data == x)) {
+                // The current node qualifies; a smaller one may still be on the left.
+                // It stays on the stack, to be visited after its left subtree
+                it.pending.push_back(current); 
+                current = current->left; 
+            } else {
+                // The current node and its left subtree are too small
+                current = current->right; 
+            }
+        }
+        // The last node pushed is the answer; the ones below it come next in order
+        return it; 
+    }
+
+    // Call callback(value) for every value in the half-open range [lo, hi) in
+    // ascending order, the same range countInRange counts. Only the
+    // O(height + k) nodes on the way to lo and in the range are visited.
+    template <typename Callback>
+    void forEachInRange(int lo, int hi, Callback callback) {
+        for (Iterator it = lowerBound(lo); it != end() && *it < hi; ++it) {
+            callback(*it); 
+        }
+    }
+
+    // Function to get the extra bytes per node spent on the subtree size
+    // compared to a node with only data and two child pointers
+    static int sizeFieldOverheadBytes() {
+        // Same layout as the node without the size field
+        struct PlainNode {
+            int data; 
+            PlainNode* left; 
+            PlainNode* right; 
+        };
+        return (int)(sizeof(Node) - sizeof(PlainNode)); 
+    }
+
+    // Rebuild the tree into a balanced shape in O(n) time and O(1) extra space
+    // (Day-Stout-Warren): first rotate it into a sorted right-leaning chain
+    // (the "vine"), then fold the chain back into a tree with left rotations
+    void rebalance() {
+        // Rebuild the subtree that starts at the root
+        root = rebuildSubtree(root); 
+    }
+
+    // Rebuild a subtree into a balanced shape with Day-Stout-Warren; returns its new root
+    Node* rebuildSubtree(Node* subtreeRoot) {
+        // Temporary node above the subtree root so it can be rotated like any other node
+        Node pseudoRoot(0); 
+        pseudoRoot.right = subtreeRoot; 
+        // Turn the tree into a vine and count its nodes
+        int size = treeToVine(&pseudoRoot); 
+        // Number of nodes that do not fit into the largest complete tree
+        int complete = 1; 
+        while (complete * 2 <= size + 1) {
+            complete *= 2; 
+        }
+        int leaves = size + 1 - complete; 
+        // Fold the extra nodes into the bottom level first
+        compress(&pseudoRoot, leaves); 
+        size -= leaves; 
+        // Then halve the vine repeatedly until it is a complete tree
+        while (size > 1) {
+            compress(&pseudoRoot, size / 2); 
+            size /= 2; 
+        }
+        // The pseudo root's right child is the new subtree root
+        return pseudoRoot.right; 
+    }
+
+    // Rotate every left child up until the tree below pseudoRoot is a right-only vine; returns its length
+    int treeToVine(Node* pseudoRoot) {
+        // Last node already on the vine, and the part still to be straightened
+        Node* vineTail = pseudoRoot; 
+        Node* remainder = vineTail->right; 
+        int size = 0; 
+        while (remainder != nullptr) {
+            if (remainder->left == nullptr) {
+                // No left child: the node joins the vine
+                vineTail = remainder; 
+                remainder = remainder->right; 
+                size++; 
+            } else {
+                // Rotate the left child up (right rotation); it takes over the subtree size
+                Node* leftChild = remainder->left; 
+                remainder->left = leftChild->right; 
+                leftChild->right = remainder; 
+                leftChild->size = remainder->size; 
+                updateSize(remainder); 
+                remainder = leftChild; 
+                vineTail->right = leftChild; 
+            }
+        }
+        return size; 
+    }
+
+    // Left-rotate every second node of the first 2 * count vine nodes below pseudoRoot
+    void compress(Node* pseudoRoot, int count) {
+        Node* scanner = pseudoRoot; 
+        for (int i = 0; i < count; i++) {
+            // The child moves down to become the left child of its right neighbour,
+            // which takes over the child's subtree size
+            Node* child = scanner->right; 
+            scanner->right = child->right; 
+            scanner = scanner->right; 
+            child->right = scanner->left; 
+            scanner->left = child; 
+            scanner->size = child->size; 
+            updateSize(child); 
+        }
+    }
 };
@@ -0,0 +1,298 @@
+#include <iostream>
+#include <queue>
+#include <vector>
+
+using namespace std;
+
+// Define a Node class for the splay tree
+class Node {
+public:
+    // Data stored in the node
+    int data; 
+    // Pointer to the left child of the node
+    Node* left; 
+    // Pointer to the right child of the node
+    Node* right; 
+
+    // Constructor to initialize a node with a given data value
+    Node(int data) {
+        // Set the data of the node
+        this->data = data; 
+        // Initialize left and right pointers to nullptr (no children)
+        this->left = nullptr; 
+        this->right = nullptr; 
+    }
+};
+
+// Define a SplayTree class: a binary search tree that moves every value it
+// searches for, inserts or deletes to the root (splaying). Values that are
+// used often therefore stay near the root, and any sequence of m operations
+// costs O(m log n) in total, even though a single operation can take O(n).
+// Splaying is done top-down in one pass without recursion, and every other
+// operation is iterative as well, because the tree can be as deep as it is large.
+class SplayTree {
+private:
+    // Pointer to the root node of the tree
+    Node* root; 
+
+    // Helper function to compare a key with a node's data for splaying: negative
+    // to go left, positive to go right, 0 to stop. With toMax the search always
+    // goes right, which splays the largest value.
+    static int compare(int key, bool toMax, Node* node) {
+        if (toMax) {
+            return 1; 
+        }
+        return (key < node->data) ? -1 : (key > node->data) ? 1 : 0; 
+    }
+
+    // Helper function for top-down splaying: bring the node holding key (or the last
+    // node on its search path) to the root of the subtree; returns the new root
+    Node* splay(Node* node, int key, bool toMax = false) {
+        // An empty subtree stays empty
+        if (node == nullptr) {
+            return nullptr; 
+        }
+        // Nodes smaller than the key collect in the left tree, larger ones in the right
+        // tree; the header's right and left pointers hold their roots
+        Node header(0); 
+        Node* leftMax = &header; 
+        Node* rightMin = &header; 
+        while (true) {
+            int direction = compare(key, toMax, node); 
+            if (direction < 0) {
+                // The key is on the left
+                if (node->left == nullptr) {
+                    break; 
+                }
+                // Zig-zig: rotate right first, so the path is halved
+                if (compare(key, toMax, node->left) < 0) {
+                    Node* child = node->left; 
+                    node->left = child->right; 
+                    child->right = node; 
+                    node = child; 
+                    if (node->left == nullptr) {
+                        break; 
+                    }
+                }
+                // Link the node into the right tree and continue on the left
+                rightMin->left = node; 
+                rightMin = node; 
+                node = node->left; 
+            } else if (direction > 0) {
+                // The key is on the right
+                if (node->right == nullptr) {
+                    break; 
+                }
+                // Zag-zag: rotate left first, so the path is halved
+                if (compare(key, toMax, node->right) > 0) {
+                    Node* child = node->right; 
+                    node->right = child->left; 
+                    child->left = node; 
+                    node = child; 
+                    if (node->right == nullptr) {
+                        break; 
+                    }
+                }
+                // Link the node into the left tree and continue on the right
+                leftMax->right = node; 
+                leftMax = node; 
+                node = node->right; 
+            } else {
+                // The key is found
+                break; 
+            }
+        }
+        // Reassemble: the left and right trees become the subtrees of the new root
+        leftMax->right = node->left; 
+        rightMin->left = node->right; 
+        node->left = header.right; 
+        node->right = header.left; 
+        return node; 
+    }
+
+public:
+    // Constructor to initialize the splay tree
+    SplayTree() {
+        // Initialize the root to null, indicating an empty tree
+        this->root = nullptr; 
+    }
+
+    // Destructor to free memory used by the tree
+    ~SplayTree() {
+        // When the tree object is destroyed, delete the entire tree starting from the root
+        deleteTree(root); 
+    }
+
+    // Delete tree helper function (iterative, O(1) extra space)
+    void deleteTree(Node* node) {
+        // Keep going until every node of the subtree is deleted
+        while (node != nullptr) {
+            if (node->left != nullptr) {
+                // Rotate the left child up, so the left side shrinks without recursion
+                Node* leftChild = node->left; 
+                node->left = leftChild->right; 
+                leftChild->right = node; 
+                node = leftChild; 
+            } else {
+                // No left child: delete the node and continue with its right subtree
+                Node* rightChild = node->right; 
+                delete node; 
+                node = rightChild; 
+            }
+        }
+    }
+
+    // Insert a node into the splay tree; the new node becomes the root
+    void insert(int value) {
+        Node* newNode = new Node(value); 
+        // If the tree is empty, the new node is the root
+        if (root == nullptr) {
+            root = newNode; 
+            return;
+        }
+        // Splay the value's neighbour to the root, then put the new node above it
+        root = splay(root, value); 
+        if (value < root->data) {
+            // The old root and its right subtree are larger than the value
+            newNode->left = root->left; 
+            newNode->right = root; 
+            root->left = nullptr; 
+        } else {
+            // The old root and its left subtree are smaller than (or equal to) the value
+            newNode->right = root->right; 
+            newNode->left = root; 
+            root->right = nullptr; 
+        }
+        root = newNode; 
+    }
+
+    // Preorder traversal of the tree (root, left, right)
+    void preorderTraversal() {
+        // If the tree is empty, there is nothing to print
+        if (root == nullptr) {
+            return;
+        }
+        // Stack of subtrees still to visit
+        vector<Node*> pending; 
+        pending.push_back(root); 
+        while (!pending.empty()) {
+            // Take the next subtree root
+            Node* current = pending.back(); 
+            pending.pop_back(); 
+            // Print the current node's data
+            cout << current->data << " "; 
+            // Push the right subtree first so the left one is visited first
+            if (current->right != nullptr) {
+                pending.push_back(current->right); 
+            }
+            if (current->left != nullptr) {
+                pending.push_back(current->left); 
+            }
+        }
+    }
+
+    // Level order traversal of the tree (Breadth-first)
+    void levelOrderTraversal() {
+        // If the tree is empty, there is no traversal to perform
+        if (root == nullptr) {
+            return;
+        }
+        // Create a queue to manage nodes while performing level order traversal
+        queue<Node*> q; 
+        // Push the root node into the queue to begin the traversal
+        q.push(root); 
+        // Traverse the tree level by level
+        while (!q.empty()) {
+            // Pop the front node from the queue
+            Node* current = q.front(); 
+            // Remove the node from the queue
+            q.pop(); 
+            // Print the current node's data
+            cout << current->data << " "; 
+            // If the current node has a left child, add it to the queue
+            if (current->left != nullptr) {
+                q.push(current->left); 
+            }
+            // If the current node has a right child, add it to the queue
+            if (current->right != nullptr) {
+                q.push(current->right); 
+            }
+        }
+    }
+
+    // Function to compute the height of the tree, level by level
+    int height() {
+        // An empty tree has height 0
+        if (root == nullptr) {
+            return 0; 
+        }
+        // Count the levels of a breadth-first traversal
+        int height = 0; 
+        queue<Node*> q; 
+        q.push(root); 
+        while (!q.empty()) {
+            // Every node currently in the queue is on the same level
+            int levelSize = q.size(); 
+            height++; 
+            // Replace the level by the next one
+            for (int i = 0; i < levelSize; i++) {
+                Node* current = q.front(); 
+                q.pop(); 
+                if (current->left != nullptr) {
+                    q.push(current->left); 
+                }
+                if (current->right != nullptr) {
+                    q.push(current->right); 
+                }
+            }
+        }
+        return height; 
+    }
+
+    // Function to compute the depth of a node given its data value. It only
+    // looks at the tree and does not splay, so it shows where the value is now.
+    int depth(int data) {
+        // Follow the search path from the root, counting the levels
+        Node* node = root; 
+        int currentDepth = 0; 
+        while (node != nullptr) {
+            // If the current node's data matches the search data, return the current depth
+            if (node->data == data) {
+                return currentDepth; 
+            }
+            // Go to the subtree that can contain the data and increment the depth
+            node = (data < node->data) ? node->left : node->right; 
+            currentDepth++; 
+        }
+        // The data is not in the tree, so the depth doesn't exist (-1)
+        return -1; 
+    }
+
+    // Function to search for a node with a specific data value; the value found
+    // (or the last node on its search path) becomes the root
+    bool search(int data) {
+        root = splay(root, data); 
+        // The value is in the tree if it is at the root now
+        return root != nullptr && root->data == data; 
+    }
+
+    // Function to delete a node with a specific data value
+    void deleteNode(int data) {
+        // Bring the value to the root; if it is not there, it is not in the tree
+        root = splay(root, data); 
+        if (root == nullptr || root->data != data) {
+            return;
+        }
+        Node* removed = root; 
+        if (root->left == nullptr) {
+            // No smaller values: the right subtree replaces the root
+            root = root->right; 
+        } else {
+            // Splay the largest smaller value to the top of the left subtree;
+            // it has no right child, so the right subtree is attached there
+            root = splay(root->left, data, true); 
+            root->right = removed->right; 
+        }
+        delete removed; 
+    }
+};
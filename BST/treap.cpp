@@ -0,0 +1,306 @@
+#include <iostream>
+#include <queue>
+#include <random>
+
+using namespace std;
+
+// Define a Node class for the treap
+class Node {
+public:
+    // Data stored in the node (the search key)
+    int data; 
+    // Random priority: a node's priority is never smaller than its children's
+    unsigned int priority; 
+    // Pointer to the left child of the node
+    Node* left; 
+    // Pointer to the right child of the node
+    Node* right; 
+
+    // Constructor to initialize a node with a given data value and priority
+    Node(int data, unsigned int priority) {
+        // Set the data and the priority of the node
+        this->data = data; 
+        this->priority = priority; 
+        // Initialize left and right pointers to nullptr (no children)
+        this->left = nullptr; 
+        this->right = nullptr; 
+    }
+};
+
+// Define a Treap class: a binary search tree by data and a heap by a random
+// priority per node. Its shape is that of a BST built by inserting the keys in
+// random order, whatever order they really arrive in, so the expected height is
+// O(log n) even for sorted input. Everything is built on two primitives:
+// split (cut a tree into keys < key and keys >= key) and merge (join two trees
+// whose key ranges do not overlap), both expected O(log n).
+class Treap {
+private:
+    // Pointer to the root node of the tree
+    Node* root; 
+
+    // Priority helper function: a xorshift generator shared by all treaps of a
+    // thread, so a treap is just its root pointer and split stays cheap
+    static unsigned int nextPriority() {
+        // Seed once per thread from the system, so input order cannot be chosen against the priorities
+        thread_local unsigned int state = random_device()() | 1u; 
+        state ^= state << 13; 
+        state ^= state >> 17; 
+        state ^= state << 5; 
+        return state; 
+    }
+
+public:
+    // Constructor to initialize an empty treap
+    Treap() {
+        // Initialize the root to null, indicating an empty tree
+        this->root = nullptr; 
+    }
+
+    // A treap owns its nodes: it can be moved (e.g. returned by split), not copied
+    Treap(Treap&& other) {
+        this->root = other.root; 
+        other.root = nullptr; 
+    }
+    Treap& operator=(Treap&& other) {
+        // Moving a treap into itself keeps it as it is
+        if (&other != this) {
+            // Free the current nodes and take over the other treap's
+            deleteTree(root); 
+            this->root = other.root; 
+            other.root = nullptr; 
+        }
+        return *this; 
+    }
+    Treap(const Treap&) = delete; 
+    Treap& operator=(const Treap&) = delete; 
+
+    // Destructor to free memory used by the tree
+    ~Treap() {
+        // When the treap object is destroyed, delete the entire tree starting from the root
+        deleteTree(root); 
+    }
+
+    // Delete tree helper function (recursive; the expected depth is O(log n))
+    void deleteTree(Node* node) {
+        // Base case: If the node is null, return (no node to delete)
+        if (node == nullptr) {
+            return;
+        }
+        // Recursively delete the left subtree
+        deleteTree(node->left); 
+        // Recursively delete the right subtree
+        deleteTree(node->right); 
+        // After the left and right subtrees are deleted, delete the current node
+        delete node; 
+    }
+
+    // Split helper function: cut a subtree into the nodes with data < key (left)
+    // and the nodes with data >= key (right)
+    void splitNode(Node* node, int key, Node*& left, Node*& right) {
+        // Base case: An empty subtree splits into two empty ones
+        if (node == nullptr) {
+            left = nullptr; 
+            right = nullptr; 
+            return;
+        }
+        if (node->data < key) {
+            // The node and its left subtree belong to the left part; split its right subtree
+            splitNode(node->right, key, node->right, right); 
+            left = node; 
+        } else {
+            // The node and its right subtree belong to the right part; split its left subtree
+            splitNode(node->left, key, left, node->left); 
+            right = node; 
+        }
+    }
+
+    // Merge helper function: join two subtrees where every key in left is <= every key in right;
+    // returns the root of the result
+    Node* mergeNodes(Node* left, Node* right) {
+        // Base case: If one side is empty, the other one is the result
+        if (left == nullptr) {
+            return right; 
+        }
+        if (right == nullptr) {
+            return left; 
+        }
+        // The root with the higher priority stays on top
+        if (left->priority > right->priority) {
+            // Merge the rest into the right subtree of the left root
+            left->right = mergeNodes(left->right, right); 
+            return left; 
+        } else {
+            // Merge the rest into the left subtree of the right root
+            right->left = mergeNodes(left, right->left); 
+            return right; 
+        }
+    }
+
+    // Insert a node into the treap
+    void insert(int value) {
+        // Cut the tree at the value and put the new node between the two parts
+        Node* left; 
+        Node* right; 
+        splitNode(root, value, left, right); 
+        Node* newNode = new Node(value, nextPriority()); 
+        root = mergeNodes(mergeNodes(left, newNode), right); 
+    }
+
+    // Move every node with data >= key into a new treap and return it;
+    // this treap keeps the nodes with data < key
+    Treap split(int key) {
+        Treap other; 
+        splitNode(root, key, root, other.root); 
+        return other; 
+    }
+
+    // Move every node of other into this treap; other is left empty.
+    // All keys of other must be >= all keys of this treap.
+    void merge(Treap& other) {
+        // If the key ranges overlap, print a message and leave both treaps unchanged
+        if (root != nullptr && other.root != nullptr && maxValueNode(root)->data > minValueNode(other.root)->data) {
+            cout << "Treaps overlap\n"; 
+            return;
+        }
+        root = mergeNodes(root, other.root); 
+        other.root = nullptr; 
+    }
+
+    // Preorder traversal of the tree (root, left, right)
+    void preorderTraversal() {
+        // Start the traversal from the root node
+        preorderTraversalNode(root); 
+    }
+
+    // Preorder traversal helper function (recursive)
+    void preorderTraversalNode(Node* node) {
+        // Base case: If the node is null, do nothing
+        if (node == nullptr) {
+            return;
+        }
+        // Print the current node's data
+        cout << node->data << " "; 
+        // Recursively traverse the left subtree
+        preorderTraversalNode(node->left); 
+        // Recursively traverse the right subtree
+        preorderTraversalNode(node->right); 
+    }
+
+    // Level order traversal of the tree (Breadth-first)
+    void levelOrderTraversal() {
+        // If the tree is empty, there is no traversal to perform
+        if (root == nullptr) {
+            return;
+        }
+        // Create a queue to manage nodes while performing level order traversal
+        queue<Node*> q; 
+        // Push the root node into the queue to begin the traversal
+        q.push(root); 
+        // Traverse the tree level by level
+        while (!q.empty()) {
+            // Pop the front node from the queue
+            Node* current = q.front(); 
+            // Remove the node from the queue
+            q.pop(); 
+            // Print the current node's data
+            cout << current->data << " "; 
+            // If the current node has a left child, add it to the queue
+            if (current->left != nullptr) {
+                q.push(current->left); 
+            }
+            // If the current node has a right child, add it to the queue
+            if (current->right != nullptr) {
+                q.push(current->right); 
+            }
+        }
+    }
+
+    // Function to compute the height of the tree
+    int height() {
+        // Call the recursive function to compute the height starting from the root
+        return heightNode(root); 
+    }
+
+    // Helper function to calculate the height of a node (subtree height)
+    int heightNode(Node* node) {
+        // Base case: If the node is null, its height is 0 (no height for an empty node)
+        if (node == nullptr) {
+            return 0; 
+        }
+        // The height of the node is 1 plus the maximum of the heights of its left and right subtrees
+        return 1 + max(heightNode(node->left), heightNode(node->right)); 
+    }
+
+    // Function to compute the depth of a node given its data value
+    int depth(int data) {
+        // Follow the search path from the root, counting the levels
+        Node* node = root; 
+        int currentDepth = 0; 
+        while (node != nullptr) {
+            // If the current node's data matches the search data, return the current depth
+            if (node->data == data) {
+                return currentDepth; 
+            }
+            // Go to the subtree that can contain the data and increment the depth
+            node = (data < node->data) ? node->left : node->right; 
+            currentDepth++; 
+        }
+        // The data is not in the tree, so the depth doesn't exist (-1)
+        return -1; 
+    }
+
+    // Function to search for a node with a specific data value
+    bool search(int data) {
+        // Walk down until the data is found or the path ends
+        Node* node = root; 
+        while (node != nullptr) {
+            // If the current node contains the data, return true (data found)
+            if (node->data == data) {
+                return true; 
+            }
+            // If the data is smaller, continue in the left subtree, otherwise in the right subtree
+            node = (data < node->data) ? node->left : node->right; 
+        }
+        // The path ended, so the data is not found
+        return false; 
+    }
+
+    // Function to delete a node with a specific data value
+    void deleteNode(int data) {
+        // Find the link that points to the first node holding the data
+        Node** link = &root; 
+        while (*link != nullptr && (*link)->data != data) {
+            link = (data < (*link)->data) ? &(*link)->left : &(*link)->right; 
+        }
+        // If the data is not in the tree, there is nothing to delete
+        if (*link == nullptr) {
+            return;
+        }
+        // Its two subtrees, merged, take its place
+        Node* node = *link; 
+        *link = mergeNodes(node->left, node->right); 
+        delete node; 
+    }
+
+    // Find the node with the minimum value in the tree (leftmost node)
+    Node* minValueNode(Node* node) {
+        // Traverse to the leftmost child to find the node with the smallest value
+        Node* current = node; 
+        while (current->left != nullptr) {
+            current = current->left; 
+        }
+        // Return the leftmost node (node with the minimum value)
+        return current; 
+    }
+
+    // Find the node with the maximum value in the tree (rightmost node)
+    Node* maxValueNode(Node* node) {
+        // Traverse to the rightmost child to find the node with the largest value
+        Node* current = node; 
+        while (current->right != nullptr) {
+            current = current->right; 
+        }
+        // Return the rightmost node (node with the maximum value)
+        return current; 
+    }
+};
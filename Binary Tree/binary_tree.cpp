@@ -1,7 +1,9 @@
 #include <iostream>
 #include <queue>
 #include <vector>
+#include <climits>
 #include <cmath>
+#include <future>
 
 using namespace std;
 
@@ -150,6 +152,24 @@ public:
         return 1 + max(getHeightHelper(node->left), getHeightHelper(node->right));
     }
 
+    // Function to get the height of the binary tree using up to the given number of threads
+    int getHeightParallel(int threads) {
+        return getHeightParallelHelper(root, splitLevels(threads));  // Call recursive helper function
+    }
+
+    // Recursive helper function for getting the height with threads. Subtree sizes are
+    // not known here, so the top levels of the tree are split and the rest is sequential.
+    int getHeightParallelHelper(Node* node, int levels) {
+        if (node == nullptr || levels <= 0) {
+            return getHeightHelper(node);  // Out of levels to split: continue sequentially
+        }
+
+        // Get the height of the left subtree on another thread and of the right one on this thread
+        future<int> left = async(launch::async, &BinaryTree::getHeightParallelHelper, this, node->left, levels - 1);
+        int right = getHeightParallelHelper(node->right, levels - 1);
+        return 1 + max(left.get(), right);
+    }
+
     // Function to count the number of nodes in the binary tree
     int countNodes() {
         return countNodesHelper(root);  // Call recursive helper function
@@ -165,6 +185,32 @@ public:
         return 1 + countNodesHelper(node->left) + countNodesHelper(node->right);
     }
 
+    // Function to count the number of nodes using up to the given number of threads
+    int countNodesParallel(int threads) {
+        return countNodesParallelHelper(root, splitLevels(threads));  // Call recursive helper function
+    }
+
+    // Recursive helper function to count nodes with threads (the top levels are split, the rest is sequential)
+    int countNodesParallelHelper(Node* node, int levels) {
+        if (node == nullptr || levels <= 0) {
+            return countNodesHelper(node);  // Out of levels to split: continue sequentially
+        }
+
+        // Count the left subtree on another thread and the right one on this thread
+        future<int> left = async(launch::async, &BinaryTree::countNodesParallelHelper, this, node->left, levels - 1);
+        int right = countNodesParallelHelper(node->right, levels - 1);
+        return 1 + left.get() + right;
+    }
+
+    // Helper function to get how many tree levels to split so that about the given number of threads is used
+    static int splitLevels(int threads) {
+        int levels = 0;
+        while ((1 << levels) < threads) {
+            levels++;  // Every split level doubles the number of threads
+        }
+        return levels;
+    }
+
     // Function to check if the binary tree is balanced (difference of heights between subtrees ≤ 1)
     bool isBalanced() {
         return isBalancedHelper(root);  // Call recursive helper function
@@ -271,11 +317,13 @@ List of Native Methods for Binary Trees
 3. Height and Depth:
    a. getHeight() - Returns the height of the binary tree.
    b. getDepth(Node* target) - Computes the depth of a specific node from the root.
+   c. getHeightParallel(int threads) - Computes the height using several threads.
 
 4. Node Count:
    a. countNodes() - Counts the total number of nodes in the binary tree.
    b. countLeafNodes() - Counts the number of leaf nodes in the tree.
    c. countNonLeafNodes() - Counts the number of non-leaf nodes.
+   d. countNodesParallel(int threads) - Counts the nodes using several threads.
 
 5. Distance and Path:
    a. printNodesAtDistance(int distance) - Prints all nodes at a specific distance from the root.
@@ -0,0 +1,341 @@
+#include <iostream>
+#include <cstdint>
+using namespace std;
+
+// Maximum number of levels a node can have (enough for 2^32 elements)
+const int MAX_LEVEL = 32;
+
+class Node;  // Declared below; links point to nodes
+
+// Link class to represent one forward pointer of a node together with its span
+class Link {
+public:
+    Node* next;  // Pointer to the next node on this level
+    int width;   // Number of level-0 steps this link skips
+
+    // Constructor to initialize a null link
+    Link() {
+        this->next = nullptr;  // No next node yet
+        this->width = 0;  // Width is filled in when the link is used
+    }
+};
+
+// Node class to represent a single node in the skip list
+class Node {
+public:
+    int data;      // Data stored in the node
+    int level;     // Number of levels this node takes part in
+    Link* links;   // One forward link per level (links[0] is the plain list)
+
+    // Constructor to initialize a node with given data and number of levels
+    Node(int data, int level) {
+        this->data = data;  // Initialize the data of the node
+        this->level = level;  // Remember how many links the node has
+        this->links = new Link[level];  // Allocate the forward links
+    }
+
+    // Destructor to free the forward links
+    ~Node() {
+        delete[] links;  // Free the link array
+    }
+};
+
+// IndexableSkipList class: the LinkedList API over an indexable skip list.
+// Every forward link stores how many elements it jumps over, so a position
+// can be reached in O(log n) expected steps by summing widths on the way down.
+// Positions are counted with the head sentinel at 0 and element i at i + 1;
+// a link that ends the list has width size + 1 - (position of its node).
+// Head and tail operations stay cheap: the last node of every level is kept,
+// so they only touch O(number of levels) links and never walk the list.
+class IndexableSkipList {
+private:
+    Node* head;              // Sentinel node in front of the first element
+    Node* last[MAX_LEVEL];   // Last node on each level (head if the level is empty)
+    int topLevel;            // Number of levels currently in use
+    int size;                // Number of elements in the list
+    uint64_t seed;           // State of the random level generator
+
+    // Draw a random level: level k is chosen with probability 2^-k
+    int randomLevel() {
+        // Advance the xorshift64 generator
+        seed ^= seed << 13;
+        seed ^= seed >> 7;
+        seed ^= seed << 17;
+        // Count the trailing one bits: each extra level has probability 1/2
+        int level = 1;
+        uint64_t bits = seed;
+        while ((bits & 1) && level < MAX_LEVEL) {
+            level++;  // Promote the node one more level
+            bits >>= 1;  // Look at the next random bit
+        }
+        return level;
+    }
+
+    // Find, for every level, the last node before skip position target and its position
+    void findPredecessors(int target, Node** update, int* updatePos) {
+        Node* current = head;  // Start from the head sentinel
+        int position = 0;  // The head is at position 0
+        // Walk down from the top level
+        for (int l = topLevel - 1; l >= 0; l--) {
+            // Move right while the next node is still before the target
+            while (current->links[l].next != nullptr && position + current->links[l].width < target) {
+                position += current->links[l].width;  // Skip over the link
+                current = current->links[l].next;  // Move to the next node
+            }
+            update[l] = current;  // Predecessor on this level
+            updatePos[l] = position;  // And its position
+        }
+    }
+
+    // Link a new node in at skip position target, given the predecessors on every level
+    void linkNode(int target, int data, Node** update, int* updatePos) {
+        int level = randomLevel();  // Pick the height of the new node
+        // Levels above the ones in use start from the head with an empty (end) link
+        for (int l = topLevel; l < level; l++) {
+            head->links[l].next = nullptr;  // Nothing on this level yet
+            head->links[l].width = size + 1;  // End link of the head
+            update[l] = head;  // The head is the predecessor
+            updatePos[l] = 0;  // At position 0
+            last[l] = head;  // And the last node on this level
+        }
+        if (level > topLevel) {
+            topLevel = level;  // More levels are in use now
+        }
+
+        Node* newNode = new Node(data, level);  // Create the new node
+        // Splice the node into each of its levels
+        for (int l = 0; l < level; l++) {
+            Link& before = update[l]->links[l];  // Link that currently jumps over the target
+            int offset = target - updatePos[l];  // Distance from the predecessor to the new node
+            newNode->links[l].next = before.next;  // New node points where the predecessor pointed
+            newNode->links[l].width = before.width - offset + 1;  // Rest of the old span (plus the new element)
+            before.next = newNode;  // Predecessor now points to the new node
+            before.width = offset;  // And spans only up to it
+            // A node whose link ends the level is the last node of that level
+            if (newNode->links[l].next == nullptr) {
+                last[l] = newNode;
+            }
+        }
+        // Links above the new node's height now jump over one more element
+        for (int l = level; l < topLevel; l++) {
+            update[l]->links[l].width++;
+        }
+        size++;  // One more element in the list
+    }
+
+    // Unlink the node right after the given predecessors
+    void unlinkNode(Node** update) {
+        Node* target = update[0]->links[0].next;  // The node being removed
+        // Fix the link on every level in use
+        for (int l = 0; l < topLevel; l++) {
+            Link& before = update[l]->links[l];  // Predecessor's link on this level
+            if (before.next == target) {
+                // Bypass the node, joining its span with the predecessor's
+                before.width += target->links[l].width - 1;
+                before.next = target->links[l].next;
+                // If the node was last on this level, the predecessor is now
+                if (before.next == nullptr) {
+                    last[l] = update[l];
+                }
+            } else {
+                // The link jumps over the node, so it spans one element less
+                before.width--;
+            }
+        }
+        delete target;  // Delete the removed node
+        size--;  // One element less in the list
+        // Drop levels that became empty (keep at least one)
+        while (topLevel > 1 && head->links[topLevel - 1].next == nullptr) {
+            topLevel--;
+        }
+    }
+
+public:
+    // Constructor to initialize an empty list
+    IndexableSkipList() {
+        head = new Node(0, MAX_LEVEL);  // Sentinel with every possible level
+        head->links[0].width = 1;  // End link of an empty list (size + 1 - 0)
+        for (int l = 0; l < MAX_LEVEL; l++) {
+            last[l] = head;  // Every level is empty, so the head is last
+        }
+        topLevel = 1;  // Only the bottom level is in use
+        size = 0;  // The list holds no elements yet
+        seed = 0x9E3779B97F4A7C15ULL;  // Any non-zero seed works for xorshift
+    }
+
+    // Destructor to free all allocated memory when the list is destroyed
+    ~IndexableSkipList() {
+        Node* current = head;  // Start from the head sentinel
+        // Iterate through all nodes on the bottom level and delete them
+        while (current != nullptr) {
+            Node* temp = current->links[0].next;  // Store the next node before deleting the current one
+            delete current;  // Delete the current node to free memory
+            current = temp;  // Move to the next node
+        }
+    }
+
+    // Method to get the number of elements in the list
+    int getSize() {
+        return size;  // Return the element count
+    }
+
+    // Method to insert a new element at the beginning of the list
+    void insertAtHead(int data) {
+        Node* update[MAX_LEVEL];
+        int updatePos[MAX_LEVEL];
+        // The head sentinel is the predecessor on every level
+        for (int l = 0; l < topLevel; l++) {
+            update[l] = head;
+            updatePos[l] = 0;
+        }
+        linkNode(1, data, update, updatePos);  // The new element gets position 1
+    }
+
+    // Method to insert a new element at the end of the list
+    void insertAtTail(int data) {
+        Node* update[MAX_LEVEL];
+        int updatePos[MAX_LEVEL];
+        // The last node of every level is the predecessor; its end link tells its position
+        for (int l = 0; l < topLevel; l++) {
+            update[l] = last[l];
+            updatePos[l] = size + 1 - last[l]->links[l].width;
+        }
+        linkNode(size + 1, data, update, updatePos);  // The new element gets the last position
+    }
+
+    // Method to insert a new element at a specific position
+    void insertAtPosition(int position, int data) {
+        // If position is invalid (out of bounds), print a message and return
+        if (position < 0 || position > size) {
+            cout << "Position out of bounds\n";  // Print an error message
+            return;
+        }
+        Node* update[MAX_LEVEL];
+        int updatePos[MAX_LEVEL];
+        findPredecessors(position + 1, update, updatePos);  // Find where the element goes
+        linkNode(position + 1, data, update, updatePos);  // And link it in
+    }
+
+    // Method to get the element at a specific position in O(log n)
+    int get(int position) {
+        // If position is invalid (out of bounds), print a message and return
+        if (position < 0 || position >= size) {
+            cout << "Position out of bounds\n";  // Print an error message
+            return -1;  // Return -1 to indicate failure
+        }
+        Node* current = head;  // Start from the head sentinel
+        int target = position + 1;  // Skip position of the element
+        int pos = 0;  // The head is at position 0
+        // Walk down from the top level, never overshooting the target
+        for (int l = topLevel - 1; l >= 0; l--) {
+            while (current->links[l].next != nullptr && pos + current->links[l].width <= target) {
+                pos += current->links[l].width;  // Skip over the link
+                current = current->links[l].next;  // Move to the next node
+            }
+        }
+        return current->data;  // The walk ends exactly on the target
+    }
+
+    // Method to delete an element by value (first occurrence)
+    void deleteByValue(int value) {
+        // If the list is empty, print a message and return
+        if (size == 0) {
+            cout << "List is empty\n";  // Print an error message
+            return;  // Exit the function
+        }
+        // Find the position of the first match on the bottom level
+        int position = 0;
+        Node* current = head->links[0].next;
+        while (current != nullptr && current->data != value) {
+            current = current->links[0].next;  // Move to the next node
+            position++;  // Increment the index
+        }
+        // If the value is not found, print a message and return
+        if (current == nullptr) {
+            cout << "Value not found in the list\n";  // Print an error message
+            return;  // Exit the function
+        }
+        deleteAtPosition(position);  // Remove it by position
+    }
+
+    // Method to delete an element at a specific position
+    void deleteAtPosition(int position) {
+        // If the list is empty, print a message and return
+        if (size == 0) {
+            cout << "List is empty\n";  // Print an error message
+            return;  // Exit the function
+        }
+        // If position is invalid (out of bounds), print a message and return
+        if (position < 0 || position >= size) {
+            cout << "Position out of bounds\n";  // Print an error message
+            return;  // Exit the function
+        }
+        Node* update[MAX_LEVEL];
+        int updatePos[MAX_LEVEL];
+        findPredecessors(position + 1, update, updatePos);  // Find the predecessors
+        unlinkNode(update);  // And unlink the node after them
+    }
+
+    // Method to delete the element at the beginning (head)
+    void deleteFromBeginning() {
+        // If the list is empty, print a message and return
+        if (size == 0) {
+            cout << "List is empty\n";  // Print an error message
+            return;  // Exit the function
+        }
+        Node* update[MAX_LEVEL];
+        // The head sentinel is the predecessor on every level
+        for (int l = 0; l < topLevel; l++) {
+            update[l] = head;
+        }
+        unlinkNode(update);  // Unlink the first element
+    }
+
+    // Method to delete the element at the end (tail)
+    void deleteFromEnd() {
+        deleteAtPosition(size - 1);  // The last position, reached in O(log n)
+    }
+
+    // Method to search for a value in the list (any order, linear scan)
+    bool search(int value) {
+        // Traverse the bottom level to look for the value
+        Node* current = head->links[0].next;
+        while (current != nullptr) {
+            // If the value is found, return true
+            if (current->data == value) {
+                return true;  // Value found
+            }
+            current = current->links[0].next;  // Move to the next node
+        }
+        // If the value is not found, return false
+        return false;  // Value not found
+    }
+
+    // Method to search for a value in O(log n) when the list is kept in
+    // non-decreasing order (e.g. an ordered event log)
+    bool searchSorted(int value) {
+        Node* current = head;  // Start from the head sentinel
+        // Walk down from the top level, stopping before values >= value
+        for (int l = topLevel - 1; l >= 0; l--) {
+            while (current->links[l].next != nullptr && current->links[l].next->data < value) {
+                current = current->links[l].next;  // Move to the next node
+            }
+        }
+        // The next node on the bottom level is the first one >= value
+        Node* candidate = current->links[0].next;
+        return candidate != nullptr && candidate->data == value;
+    }
+
+    // Method to print all elements in the list
+    void printList() {
+        // Start from the first element and traverse the bottom level
+        Node* current = head->links[0].next;
+        while (current != nullptr) {
+            // Print the data of the current node
+            cout << current->data << " -> ";  // Display the current node's data
+            current = current->links[0].next;  // Move to the next node
+        }
+        // Print null to indicate the end of the list
+        cout << "null\n";  // Indicate the end of the list
+    }
+};
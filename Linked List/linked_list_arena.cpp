@@ -0,0 +1,311 @@
+#include <iostream>
+#include <cstdint>
+#include <vector>
+using namespace std;
+
+// Index used in place of a null pointer
+const uint32_t NIL = 0xFFFFFFFF;
+
+// ArenaNode class to represent a single node stored inside the arena
+class ArenaNode {
+public:
+    int data;        // Data stored in the node
+    uint32_t next;   // Arena index of the next node in the list (NIL at the end)
+
+    // Constructor to initialize a node with given data and no next node
+    ArenaNode(int data) {
+        this->data = data;  // Initialize the data of the node
+        this->next = NIL;  // Set the next index to NIL (no next node yet)
+    }
+};
+
+// ArenaLinkedList class: the LinkedList API with every node stored in one
+// growable array and linked by 32-bit indices instead of 64-bit pointers.
+// A node takes 8 bytes instead of 16 plus the allocator's per-block overhead.
+// Deleted nodes go on an intrusive free list (threaded through their next
+// field) and are reused by later inserts.
+class ArenaLinkedList {
+private:
+    vector<ArenaNode> nodes;  // The arena holding every node
+    uint32_t head;            // Arena index of the head (first node) of the list
+    uint32_t freeHead;        // Arena index of the first free node
+    int size;                 // Number of elements in the list
+
+    // Helper to get a node for the given data, reusing a free one if possible
+    uint32_t allocateNode(int data) {
+        // Reuse the first node of the free list if there is one
+        if (freeHead != NIL) {
+            uint32_t index = freeHead;  // Take the first free node
+            freeHead = nodes[index].next;  // The free list continues after it
+            nodes[index] = ArenaNode(data);  // Reinitialize it with the data
+            return index;
+        }
+        // Otherwise append a new node to the arena
+        nodes.push_back(ArenaNode(data));
+        return (uint32_t)(nodes.size() - 1);
+    }
+
+    // Helper to put a node on the free list
+    void freeNode(uint32_t index) {
+        nodes[index].next = freeHead;  // Link it in front of the free list
+        freeHead = index;  // It is the first free node now
+    }
+
+public:
+    // Constructor to initialize an empty linked list
+    ArenaLinkedList() {
+        head = NIL;  // Set the head to NIL indicating the list is empty
+        freeHead = NIL;  // No free nodes yet
+        size = 0;  // The list holds no elements yet
+    }
+
+    // Method to get the number of elements in the list
+    int getSize() {
+        return size;  // Return the element count
+    }
+
+    // Method to insert a new node at the beginning of the list
+    void insertAtHead(int data) {
+        // Create a new node with the given data
+        uint32_t newNode = allocateNode(data);
+        // Point the new node's next to the current head
+        nodes[newNode].next = head;
+        // Update the head to the new node
+        head = newNode;
+        size++;  // One more element in the list
+    }
+
+    // Method to insert a new node at the end of the list
+    void insertAtTail(int data) {
+        // Create a new node with the given data
+        uint32_t newNode = allocateNode(data);
+        size++;  // One more element in the list
+        // If the list is empty, set the head to the new node
+        if (head == NIL) {
+            head = newNode;  // Set the new node as the head of the list
+            return;  // Exit the function as no further action is needed
+        }
+
+        // Traverse to the last node in the list
+        uint32_t current = head;
+        while (nodes[current].next != NIL) {
+            current = nodes[current].next;  // Move to the next node
+        }
+        // Set the next of the last node to the new node
+        nodes[current].next = newNode;
+    }
+
+    // Method to insert a new node at a specific position
+    void insertAtPosition(int position, int data) {
+        // If the position is the beginning, use insertAtHead
+        if (position == 0) {
+            insertAtHead(data);  // Insert the node at the beginning
+            return;
+        }
+
+        uint32_t current = head;  // Start from the head
+        int currentIndex = 0;  // Initialize the current index
+
+        // Traverse to the node just before the desired position
+        while (current != NIL && currentIndex < position - 1) {
+            current = nodes[current].next;  // Move to the next node
+            currentIndex++;  // Increment the index
+        }
+
+        // If position is invalid (out of bounds), print a message and return
+        if (current == NIL || position < 0) {
+            cout << "Position out of bounds\n";  // Print an error message
+            return;
+        }
+
+        // Create the node only now, so a failed insert allocates nothing
+        uint32_t newNode = allocateNode(data);
+        // Insert the new node by updating the next indices
+        nodes[newNode].next = nodes[current].next;  // Set the new node's next to the current node's next
+        nodes[current].next = newNode;  // Set the current node's next to the new node
+        size++;  // One more element in the list
+    }
+
+    // Method to delete a node by value
+    void deleteByValue(int value) {
+        // If the list is empty, print a message and return
+        if (head == NIL) {
+            cout << "List is empty\n";  // Print an error message
+            return;  // Exit the function
+        }
+
+        // If the value is at the head, update the head and free the node
+        if (nodes[head].data == value) {
+            uint32_t temp = head;  // Store the current head in temp
+            head = nodes[head].next;  // Update the head to the next node
+            freeNode(temp);  // Free the old head node
+            size--;  // One element less in the list
+            return;  // Exit the function
+        }
+
+        // Traverse the list to find the node with the given value
+        uint32_t current = head;
+        while (nodes[current].next != NIL && nodes[nodes[current].next].data != value) {
+            current = nodes[current].next;  // Move to the next node
+        }
+
+        // If the value is not found, print a message and return
+        if (nodes[current].next == NIL) {
+            cout << "Value not found in the list\n";  // Print an error message
+            return;  // Exit the function
+        }
+
+        // Delete the node by updating the next index of the previous node
+        uint32_t temp = nodes[current].next;  // Store the node to be deleted
+        nodes[current].next = nodes[temp].next;  // Bypass the node to be deleted
+        freeNode(temp);  // Free the node
+        size--;  // One element less in the list
+    }
+
+    // Method to delete a node at a specific position
+    void deleteAtPosition(int position) {
+        // If the list is empty, print a message and return
+        if (head == NIL) {
+            cout << "List is empty\n";  // Print an error message
+            return;  // Exit the function
+        }
+
+        // If the position is the beginning, update the head and free the node
+        if (position == 0) {
+            deleteFromBeginning();  // Remove the head node
+            return;  // Exit the function
+        }
+
+        uint32_t current = head;  // Start from the head node
+        int currentIndex = 0;  // Initialize the current index
+
+        // Traverse to the node just before the desired position
+        while (current != NIL && currentIndex < position - 1) {
+            current = nodes[current].next;  // Move to the next node
+            currentIndex++;  // Increment the index
+        }
+
+        // If position is invalid (out of bounds), print a message and return
+        if (current == NIL || nodes[current].next == NIL || position < 0) {
+            cout << "Position out of bounds\n";  // Print an error message
+            return;  // Exit the function
+        }
+
+        // Delete the node by updating the next index of the previous node
+        uint32_t temp = nodes[current].next;  // Store the node to be deleted
+        nodes[current].next = nodes[temp].next;  // Bypass the node to be deleted
+        freeNode(temp);  // Free the node
+        size--;  // One element less in the list
+    }
+
+    // Method to delete a node from the beginning (head)
+    void deleteFromBeginning() {
+        // If the list is empty, print a message and return
+        if (head == NIL) {
+            cout << "List is empty\n";  // Print an error message
+            return;  // Exit the function
+        }
+
+        uint32_t temp = head;  // Store the current head node in temp
+        head = nodes[head].next;  // Update the head to the next node
+        freeNode(temp);  // Free the old head node
+        size--;  // One element less in the list
+    }
+
+    // Method to delete a node from the end (tail)
+    void deleteFromEnd() {
+        // If the list is empty, print a message and return
+        if (head == NIL) {
+            cout << "List is empty\n";  // Print an error message
+            return;  // Exit the function
+        }
+
+        // If the list has only one node, free it
+        if (nodes[head].next == NIL) {
+            freeNode(head);  // Free the only node in the list
+            head = NIL;  // Set the head to NIL as the list is now empty
+            size--;  // One element less in the list
+            return;  // Exit the function
+        }
+
+        // Traverse to the second last node in the list
+        uint32_t current = head;
+        while (nodes[nodes[current].next].next != NIL) {
+            current = nodes[current].next;  // Move to the next node
+        }
+
+        // Free the last node (current's next is the last node)
+        freeNode(nodes[current].next);  // Free the last node
+        nodes[current].next = NIL;  // Set the second last node's next to NIL
+        size--;  // One element less in the list
+    }
+
+    // Method to search for a value in the list
+    bool search(int value) {
+        // Traverse the list to look for the value
+        uint32_t current = head;
+        while (current != NIL) {
+            // If the value is found, return true
+            if (nodes[current].data == value) {
+                return true;  // Value found
+            }
+            current = nodes[current].next;  // Move to the next node
+        }
+        // If the value is not found, return false
+        return false;  // Value not found
+    }
+
+    // Method to rewrite the arena in traversal order: afterwards node i links
+    // to node i + 1, so every later walk over the list is a sequential scan.
+    // Free nodes are dropped and the arena shrinks to fit.
+    void compact() {
+        vector<ArenaNode> ordered;  // New arena in list order
+        ordered.reserve(size);  // Exactly one slot per element
+        // Copy the nodes in traversal order, linking each to the next slot
+        for (uint32_t current = head; current != NIL; current = nodes[current].next) {
+            ordered.push_back(ArenaNode(nodes[current].data));  // Copy the data
+            ordered.back().next = (uint32_t)ordered.size();  // Link to the following slot
+        }
+        // The last node ends the list
+        if (!ordered.empty()) {
+            ordered.back().next = NIL;
+        }
+        nodes.swap(ordered);  // Replace the old arena
+        head = nodes.empty() ? NIL : 0;  // The head is the first slot
+        freeHead = NIL;  // No free nodes are left
+    }
+
+    // Method to get the average number of arena bytes used per element
+    double bytesPerElement() {
+        // An empty list has no per-element cost
+        if (size == 0) {
+            return 0;
+        }
+        // Count the whole arena, including free nodes and spare capacity
+        return (double)nodes.capacity() * sizeof(ArenaNode) / size;
+    }
+
+    // Method to get the bytes per element of the pointer-based LinkedList node
+    // (an int and a 64-bit pointer, padded), not counting allocator overhead
+    static double pointerBytesPerElement() {
+        // Same layout as the Node class of linked_list.cpp
+        struct PointerNode {
+            int data;
+            PointerNode* next;
+        };
+        return sizeof(PointerNode);
+    }
+
+    // Method to print all elements in the list
+    void printList() {
+        // Start from the head and traverse the list
+        uint32_t current = head;
+        while (current != NIL) {
+            // Print the data of the current node
+            cout << nodes[current].data << " -> ";  // Display the current node's data
+            current = nodes[current].next;  // Move to the next node
+        }
+        // Print null to indicate the end of the list
+        cout << "null\n";  // Indicate the end of the list
+    }
+};
@@ -0,0 +1,344 @@
+#include <iostream>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <utility>
+#include <vector>
+using namespace std;
+
+// Node class to represent a single node in the lock-free sorted list
+class Node {
+public:
+    int data;                 // Key stored in the node
+    atomic<uintptr_t> next;   // Address of the next node; the lowest bit marks this node as deleted
+
+    // Constructor to initialize a node with given data and null next pointer
+    Node(int data) {
+        this->data = data;  // Initialize the data of the node
+        this->next.store(0, memory_order_relaxed);  // No next node yet, not deleted
+    }
+};
+
+// EpochReclaimer class: epoch-based memory reclamation for removed nodes.
+// A thread announces the global epoch while it reads the list. A removed node
+// is tagged with the epoch it was retired in and is only deleted once the
+// global epoch has moved two steps further, because by then every thread that
+// could still hold a pointer to it has left its read section.
+// Each thread that touches the list claims one of MAX_THREADS records and keeps
+// it until the thread exits; a thread that finds no free record aborts.
+class EpochReclaimer {
+private:
+    // Maximum number of threads that can use the list at the same time
+    static const int MAX_THREADS = 128;
+    // Number of retired nodes after which a thread tries to free memory
+    static const int SCAN_INTERVAL = 64;
+
+    // Per-thread announcement, padded so threads do not share a cache line
+    struct alignas(64) ThreadRecord {
+        atomic<uint64_t> epoch;   // Epoch the thread entered its read section in
+        atomic<bool> active;      // True while the thread is inside a read section
+        atomic<bool> claimed;     // True while a thread owns this record
+    };
+
+    // Per-thread state: the claimed record and the nodes waiting to be freed
+    struct LocalState {
+        int slot;                                 // Index of the claimed record (-1 if none)
+        vector<pair<uint64_t, Node*> > limbo;     // Retired nodes with their retire epoch
+        int retiredSinceScan;                     // Retires since the last attempt to free
+
+        // Constructor to start without a record
+        LocalState() {
+            this->slot = -1;
+            this->retiredSinceScan = 0;
+        }
+
+        // Destructor to hand leftover nodes to the shared orphan list and release the record
+        ~LocalState() {
+            {
+                lock_guard<mutex> guard(shared().orphanLock);
+                for (size_t i = 0; i < limbo.size(); i++) {
+                    shared().orphans.push_back(limbo[i]);
+                }
+            }
+            if (slot >= 0) {
+                shared().records[slot].claimed.store(false, memory_order_release);
+            }
+        }
+    };
+
+    // State shared by all threads
+    struct Shared {
+        atomic<uint64_t> globalEpoch;               // The global epoch counter
+        ThreadRecord records[MAX_THREADS];          // Announcements of all threads
+        mutex orphanLock;                           // Lock for the orphan list
+        vector<pair<uint64_t, Node*> > orphans;     // Retired nodes of threads that exited
+
+        // Constructor to start at epoch 0 with no threads registered
+        Shared() {
+            globalEpoch.store(0);
+            for (int i = 0; i < MAX_THREADS; i++) {
+                records[i].epoch.store(0);
+                records[i].active.store(false);
+                records[i].claimed.store(false);
+            }
+        }
+
+        // Destructor to free everything once no thread can use the list any more
+        ~Shared() {
+            for (size_t i = 0; i < orphans.size(); i++) {
+                delete orphans[i].second;
+            }
+        }
+    };
+
+    // Get the shared state (created on first use)
+    static Shared& shared() {
+        static Shared s;
+        return s;
+    }
+
+    // Get the calling thread's state, claiming a record on first use
+    static LocalState& local() {
+        static thread_local LocalState state;
+        // Claim a free record the first time this thread shows up
+        if (state.slot < 0) {
+            for (int i = 0; i < MAX_THREADS; i++) {
+                bool expected = false;
+                if (shared().records[i].claimed.compare_exchange_strong(expected, true)) {
+                    state.slot = i;
+                    break;
+                }
+            }
+        }
+        // Every record is owned by a live thread: waiting could block forever, so stop here
+        if (state.slot < 0) {
+            cout << "Too many threads! At most " << MAX_THREADS << " threads can use the list at once" << endl;
+            abort();
+        }
+        return state;
+    }
+
+    // Move the global epoch forward if every active thread has caught up with it
+    static void tryAdvance() {
+        uint64_t epoch = shared().globalEpoch.load();
+        // A thread still in an older epoch may hold pointers retired back then
+        for (int i = 0; i < MAX_THREADS; i++) {
+            ThreadRecord& record = shared().records[i];
+            if (record.claimed.load() && record.active.load() && record.epoch.load() != epoch) {
+                return;
+            }
+        }
+        // Everyone is in the current epoch: start the next one
+        shared().globalEpoch.compare_exchange_strong(epoch, epoch + 1);
+    }
+
+    // Delete the nodes of a list that were retired at least two epochs ago
+    static void freeSafe(vector<pair<uint64_t, Node*> >& nodes, uint64_t epoch) {
+        size_t kept = 0;
+        for (size_t i = 0; i < nodes.size(); i++) {
+            if (nodes[i].first + 2 <= epoch) {
+                delete nodes[i].second;  // No thread can reach it any more
+            } else {
+                nodes[kept++] = nodes[i];  // Keep it for a later scan
+            }
+        }
+        nodes.resize(kept);
+    }
+
+public:
+    // Enter a read section: pointers read from the list stay valid until exit()
+    static void enter() {
+        ThreadRecord& record = shared().records[local().slot];
+        // Announce the current epoch, retrying if it moved while announcing
+        while (true) {
+            uint64_t epoch = shared().globalEpoch.load();
+            record.epoch.store(epoch);
+            record.active.store(true);
+            if (shared().globalEpoch.load() == epoch) {
+                return;
+            }
+        }
+    }
+
+    // Leave a read section
+    static void exit() {
+        shared().records[local().slot].active.store(false);
+    }
+
+    // Hand over a node that has been unlinked from the list
+    static void retire(Node* node) {
+        LocalState& state = local();
+        // Tag the node with the epoch it was retired in
+        state.limbo.push_back(make_pair(shared().globalEpoch.load(), node));
+        // Every SCAN_INTERVAL retires, try to advance the epoch and free memory
+        if (++state.retiredSinceScan >= SCAN_INTERVAL) {
+            state.retiredSinceScan = 0;
+            tryAdvance();
+            uint64_t epoch = shared().globalEpoch.load();
+            freeSafe(state.limbo, epoch);
+            // Also free nodes left behind by threads that exited
+            lock_guard<mutex> guard(shared().orphanLock);
+            freeSafe(shared().orphans, epoch);
+        }
+    }
+};
+
+// EpochGuard class: enters a read section on construction and leaves it on destruction
+class EpochGuard {
+public:
+    EpochGuard() {
+        EpochReclaimer::enter();  // Start protecting the nodes this thread reads
+    }
+    ~EpochGuard() {
+        EpochReclaimer::exit();  // Stop protecting them
+    }
+};
+
+// LockFreeSortedList class: a concurrent set of ints kept as a sorted linked
+// list (Harris-Michael). A node is removed in two steps: first its next
+// pointer is marked (logical deletion), then it is unlinked (physical
+// deletion), which any thread that walks past it may finish. insert and
+// remove are lock-free; contains never writes and never retries, so it is
+// wait-free. Removed nodes are freed through EpochReclaimer.
+// At most 128 threads (EpochReclaimer::MAX_THREADS) may have used the list and
+// still be running at the same time; one more terminates the program.
+class LockFreeSortedList {
+private:
+    Node* head;  // Sentinel node in front of the first element
+
+    // Helpers to work with the mark bit stored in a next field
+    static bool isMarked(uintptr_t link) {
+        return (link & 1) != 0;  // Lowest bit set means the owner is deleted
+    }
+    static Node* pointerOf(uintptr_t link) {
+        return (Node*)(link & ~(uintptr_t)1);  // Clear the mark bit
+    }
+
+    // Find the first node with data >= value and its predecessor, unlinking
+    // marked nodes on the way. Returns true if that node holds value.
+    bool find(int value, Node*& prev, Node*& current) {
+    retry:
+        prev = head;  // Start from the head sentinel
+        current = pointerOf(prev->next.load(memory_order_acquire));  // First real node
+        while (current != nullptr) {
+            uintptr_t succ = current->next.load(memory_order_acquire);  // Current node's next link
+            // The current node is logically deleted: unlink it before going on
+            if (isMarked(succ)) {
+                uintptr_t expected = (uintptr_t)current;  // Predecessor must still point to it, unmarked
+                if (!prev->next.compare_exchange_strong(expected, (uintptr_t)pointerOf(succ), memory_order_acq_rel, memory_order_acquire)) {
+                    goto retry;  // The predecessor changed: start over
+                }
+                EpochReclaimer::retire(current);  // This thread unlinked it, so it retires it
+                current = pointerOf(succ);  // Continue with the successor
+                continue;
+            }
+            // Stop at the first node that is not smaller than the value
+            if (current->data >= value) {
+                return current->data == value;
+            }
+            prev = current;  // Move the predecessor forward
+            current = pointerOf(succ);  // Move to the next node
+        }
+        return false;  // Reached the end of the list
+    }
+
+public:
+    // Constructor to initialize an empty list
+    LockFreeSortedList() {
+        head = new Node(0);  // The sentinel's data is never compared
+    }
+
+    // Destructor to free all nodes (no other thread may use the list any more)
+    ~LockFreeSortedList() {
+        Node* current = head;  // Start from the head sentinel
+        // Iterate through all nodes still linked and delete them
+        while (current != nullptr) {
+            Node* temp = pointerOf(current->next.load(memory_order_relaxed));  // Store the next node before deleting the current one
+            delete current;  // Delete the current node to free memory
+            current = temp;  // Move to the next node
+        }
+    }
+
+    // Method to add a value; returns false if it is already present
+    bool insert(int value) {
+        EpochGuard guard;  // Keep the nodes we read alive
+        Node* newNode = nullptr;  // Created on the first attempt only
+        while (true) {
+            Node* prev;
+            Node* current;
+            // If the value is already in the set, nothing to do
+            if (find(value, prev, current)) {
+                delete newNode;  // Never published, so it can be deleted directly
+                return false;
+            }
+            if (newNode == nullptr) {
+                newNode = new Node(value);  // Create the new node
+            }
+            newNode->next.store((uintptr_t)current, memory_order_relaxed);  // Point it at its successor
+            uintptr_t expected = (uintptr_t)current;  // Predecessor must still point there, unmarked
+            // Publish the node; on failure the list changed, so search again
+            if (prev->next.compare_exchange_strong(expected, (uintptr_t)newNode, memory_order_release, memory_order_relaxed)) {
+                return true;
+            }
+        }
+    }
+
+    // Method to remove a value; returns false if it is not present
+    bool remove(int value) {
+        EpochGuard guard;  // Keep the nodes we read alive
+        while (true) {
+            Node* prev;
+            Node* current;
+            // If the value is not in the set, nothing to do
+            if (!find(value, prev, current)) {
+                return false;
+            }
+            uintptr_t succ = current->next.load(memory_order_acquire);  // Successor link
+            // Another thread is already removing this node: search again
+            if (isMarked(succ)) {
+                continue;
+            }
+            // Logical deletion: mark the node's next link; only one remover can win
+            if (!current->next.compare_exchange_strong(succ, succ | 1, memory_order_acq_rel, memory_order_relaxed)) {
+                continue;
+            }
+            // Physical deletion: try to unlink it right away
+            uintptr_t expected = (uintptr_t)current;
+            if (prev->next.compare_exchange_strong(expected, succ, memory_order_acq_rel, memory_order_relaxed)) {
+                EpochReclaimer::retire(current);  // This thread unlinked it, so it retires it
+            } else {
+                find(value, prev, current);  // Let a search unlink it instead
+            }
+            return true;
+        }
+    }
+
+    // Method to check whether a value is present (wait-free: a single pass, no writes)
+    bool contains(int value) {
+        EpochGuard guard;  // Keep the nodes we read alive
+        Node* current = pointerOf(head->next.load(memory_order_acquire));  // First real node
+        // Skip all nodes with smaller values, deleted or not
+        while (current != nullptr && current->data < value) {
+            current = pointerOf(current->next.load(memory_order_acquire));  // Move to the next node
+        }
+        // Found only if the node holds the value and is not marked as deleted
+        return current != nullptr && current->data == value && !isMarked(current->next.load(memory_order_acquire));
+    }
+
+    // Method to print all elements in the list (not safe while other threads modify it)
+    void printList() {
+        // Start from the first real node and traverse the list
+        Node* current = pointerOf(head->next.load(memory_order_acquire));
+        while (current != nullptr) {
+            uintptr_t succ = current->next.load(memory_order_acquire);  // Current node's next link
+            // Skip nodes that are deleted but not yet unlinked
+            if (!isMarked(succ)) {
+                cout << current->data << " -> ";  // Display the current node's data
+            }
+            current = pointerOf(succ);  // Move to the next node
+        }
+        // Print null to indicate the end of the list
+        cout << "null\n";  // Indicate the end of the list
+    }
+};
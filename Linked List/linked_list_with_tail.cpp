@@ -1,24 +1,136 @@
 #include <iostream>
+#include "../node_magazine.h"
+#include "list_merge_sort.h"
+#include <algorithm>
+#include <functional>
+#include <new>
+#include <thread>
+#include <vector>
 using namespace std;
 
 // Node class to represent a single node in the linked list
 class Node {
 public:
     int data;       // Data stored in the node
+    bool pooled;    // True if the node lives in a block allocated by appendRange (fits in the padding after data)
     Node* next;     // Pointer to the next node in the list
 
     // Constructor to initialize a node with given data and null next pointer
     Node(int data) {
         this->data = data;  // Initialize the data of the node
+        this->pooled = false;  // Nodes are allocated on their own unless a block creates them
         this->next = nullptr;  // Set the next pointer to null (no next node yet)
     }
 };
 
+// Cursor class to remember a position in the list. A singly linked list can
+// only be walked forward, so the cursor keeps the nodes in front of it: path[i]
+// is the node at position i and the cursor sits at position path.size().
+// Moving back drops entries and moving forward appends them, so both cost
+// O(distance), at the price of one pointer per position in front of the cursor.
+class Cursor {
+public:
+    vector<Node*> path;  // Nodes in front of the cursor, starting with the head
+
+    // Method to get the position of the cursor
+    int position() {
+        return (int)path.size();  // One node in front of it per position
+    }
+
+    // Method to move the cursor back to the head
+    void reset() {
+        path.clear();  // No node is in front of the head
+    }
+};
+
 // LinkedList class to manage the operations on the list
 class LinkedList {
 private:
+    // One allocation holding the nodes of an appendRange call
+    struct NodeBlock {
+        Node* nodes;  // First node of the block
+        int size;     // Number of nodes the block holds
+        int live;     // Number of its nodes that are not deleted yet
+    };
+
     Node* head;  // Pointer to the head (first node) of the list
     Node* tail;  // Pointer to the tail (last node) of the list
+    Cursor cursor;  // Position of the cursor, also left by the most recent positional operation
+    vector<NodeBlock> blocks;  // Node blocks allocated by appendRange, sorted by address
+    static const int PARALLEL_SORT_MIN_CHUNK = 16384;  // Fewest nodes worth sorting on a thread of their own
+
+    // Helper to free a node: a node from a block only gives its memory back
+    // together with the rest of its block, once every node in it is deleted
+    void destroyNode(Node* node) {
+        // Nodes created on their own are recycled one by one (through the node magazines)
+        if (!node->pooled) {
+            NodeMagazine<Node>::destroy(node);
+            return;
+        }
+        // Find the block holding the node: the last one starting at or before it
+        vector<NodeBlock>::iterator block = upper_bound(blocks.begin(), blocks.end(), node,
+            [](Node* n, const NodeBlock& b) { return less<Node*>()(n, b.nodes); });
+        --block;
+        // Free the block with its last live node
+        if (--block->live == 0) {
+            ::operator delete(block->nodes);
+            blocks.erase(block);
+        }
+    }
+
+    // Helper to keep the blocks sorted by address after adding some at the end
+    void sortBlocks() {
+        std::sort(blocks.begin(), blocks.end(), [](const NodeBlock& a, const NodeBlock& b) {
+            return less<Node*>()(a.nodes, b.nodes);  // Order by start address
+        });
+    }
+
+    // Helper to create nodes for all values in one allocation and link them
+    // into a chain; returns the first node and stores the last one in last
+    Node* allocateBlock(const vector<int>& values, Node*& last) {
+        // One raw allocation large enough for every node
+        Node* block = static_cast<Node*>(::operator new(values.size() * sizeof(Node)));
+        // Remember the block and how many of its nodes are in use
+        NodeBlock entry = { block, (int)values.size(), (int)values.size() };
+        blocks.insert(upper_bound(blocks.begin(), blocks.end(), block,
+            [](Node* n, const NodeBlock& b) { return less<Node*>()(n, b.nodes); }), entry);  // At its sorted position
+        // Construct the nodes in place and link each one to the next
+        for (size_t i = 0; i < values.size(); i++) {
+            Node* node = new (&block[i]) Node(values[i]);  // Construct the node in the block
+            node->pooled = true;  // It must not be deleted on its own
+            node->next = (i + 1 < values.size()) ? &block[i + 1] : nullptr;  // Link to the next node
+        }
+        last = &block[values.size() - 1];  // The last node ends the chain
+        return block;  // The first node starts it
+    }
+
+    // Helper to get the node at the cursor (nullptr when the cursor is at the end of the list)
+    Node* cursorNode() {
+        return cursor.path.empty() ? head : cursor.path.back()->next;
+    }
+
+    // Helper to move the cursor to a position; returns false (with the cursor at
+    // the end of the list) if the list is shorter. The walk starts from the cursor
+    // in either direction, so runs of edits at nearby positions only cover the
+    // distance between them and never restart from the head.
+    bool moveTo(int position) {
+        // Negative positions never exist
+        if (position < 0) {
+            return false;
+        }
+        // A position in front of the cursor is reached by dropping path entries
+        if (position <= cursor.position()) {
+            cursor.path.resize(position);
+            return true;
+        }
+        // Otherwise walk forward from the cursor, recording every node passed
+        Node* current = cursorNode();
+        while (current != nullptr && cursor.position() < position) {
+            cursor.path.push_back(current);  // The node is now in front of the cursor
+            current = current->next;  // Move to the next node
+        }
+        return cursor.position() == position;  // False if the list ended first
+    }
 
 public:
     // Constructor to initialize an empty linked list
@@ -29,23 +141,33 @@ public:
 
     // Destructor to free all allocated memory when the list is destroyed
     ~LinkedList() {
+        clear();  // Delete all nodes and blocks
+    }
+
+    // Method to remove all elements and free all memory of the list
+    void clear() {
         Node* current = head;  // Start from the head node
         // Iterate through all nodes and delete them
         while (current != nullptr) {
             Node* temp = current->next;  // Store the next node before deleting the current one
-            delete current;  // Delete the current node to free memory
+            destroyNode(current);  // Delete the current node to free memory
             current = temp;  // Move to the next node
         }
+        head = nullptr;  // The list is empty
+        tail = nullptr;
+        cursor.reset();  // The cursor is back at the (empty) head
     }
 
     // Method to insert a new node at the beginning of the list
     void insertAtHead(int data) {
         // Create a new node with the given data
-        Node* newNode = new Node(data);
+        Node* newNode = NodeMagazine<Node>::create(data);
         // Point the new node's next to the current head
         newNode->next = head;
         // Update the head to the new node
         head = newNode;
+        // Every position in front of the cursor moved, so it goes back to the head
+        cursor.reset();
 
         // If the list was empty, update the tail pointer
         if (tail == nullptr) {
@@ -56,7 +178,7 @@ public:
     // Method to insert a new node at the end of the list
     void insertAtTail(int data) {
         // Create a new node with the given data
-        Node* newNode = new Node(data);
+        Node* newNode = NodeMagazine<Node>::create(data);
         
         // If the list is empty, set both head and tail to the new node
         if (head == nullptr) {
@@ -71,40 +193,15 @@ public:
         tail = newNode;
     }
 
-    // Method to insert a new node at a specific position
+    // Method to insert a new node at a specific position (walking from the cursor)
     void insertAtPosition(int position, int data) {
-        // If the position is the beginning, use insertAtHead
-        if (position == 0) {
-            insertAtHead(data);  // Insert the node at the beginning
-            return;
-        }
-
-        // Create a new node with the given data
-        Node* newNode = new Node(data);
-        Node* current = head;  // Start from the head
-        int currentIndex = 0;  // Initialize the current index
-
-        // Traverse to the node just before the desired position
-        while (current != nullptr && currentIndex < position - 1) {
-            current = current->next;  // Move to the next node
-            currentIndex++;  // Increment the index
-        }
-
-        // If position is invalid (out of bounds), print a message and return
-        if (current == nullptr) {
+        // Move the cursor to the position; if the list is too short, print a message and return
+        if (!moveTo(position)) {
             cout << "Position out of bounds\n";  // Print an error message
-            delete newNode;  // Delete the new node as it will not be used
             return;
         }
-
-        // Insert the new node by updating the next pointers
-        newNode->next = current->next;  // Set the new node's next to the current node's next
-        current->next = newNode;  // Set the current node's next to the new node
-
-        // If the new node is inserted at the end, update the tail pointer
-        if (newNode->next == nullptr) {
-            tail = newNode;  // Update tail to the new node
-        }
+        // Insert the new node in front of the cursor
+        insertAtCursor(data);
     }
 
     // Method to delete a node by value
@@ -115,11 +212,14 @@ public:
             return;  // Exit the function
         }
 
+        // The position of the deleted node is not tracked, so the cursor goes back to the head
+        cursor.reset();
+
         // If the value is at the head, update the head pointer and delete the node
         if (head->data == value) {
             Node* temp = head;  // Store the current head in temp
             head = head->next;  // Update the head to the next node
-            delete temp;  // Delete the old head node
+            destroyNode(temp);  // Delete the old head node
 
             // If the list becomes empty after deletion, set tail to nullptr
             if (head == nullptr) {
@@ -144,7 +244,7 @@ public:
         // Delete the node by updating the next pointer of the previous node
         Node* temp = current->next;  // Store the node to be deleted
         current->next = temp->next;  // Bypass the node to be deleted
-        delete temp;  // Delete the node
+        destroyNode(temp);  // Delete the node
 
         // If the node deleted was the tail, update the tail pointer
         if (current->next == nullptr) {
@@ -160,44 +260,14 @@ public:
             return;  // Exit the function
         }
 
-        // If the position is the beginning, update the head and delete the node
-        if (position == 0) {
-            Node* temp = head;  // Store the current head node in temp
-            head = head->next;  // Update the head to the next node
-            delete temp;  // Delete the old head node
-
-            // If the list becomes empty after deletion, set tail to nullptr
-            if (head == nullptr) {
-                tail = nullptr;
-            }
-
-            return;  // Exit the function
-        }
-
-        Node* current = head;  // Start from the head node
-        int currentIndex = 0;  // Initialize the current index
-
-        // Traverse to the node just before the desired position
-        while (current != nullptr && currentIndex < position - 1) {
-            current = current->next;  // Move to the next node
-            currentIndex++;  // Increment the index
-        }
-
-        // If position is invalid (out of bounds), print a message and return
-        if (current == nullptr || current->next == nullptr) {
+        // Move the cursor to the position (walking from the cursor); it must be on a node
+        if (!moveTo(position) || cursorNode() == nullptr) {
             cout << "Position out of bounds\n";  // Print an error message
             return;  // Exit the function
         }
 
-        // Delete the node by updating the next pointer of the previous node
-        Node* temp = current->next;  // Store the node to be deleted
-        current->next = temp->next;  // Bypass the node to be deleted
-        delete temp;  // Delete the node
-
-        // If the node deleted was the tail, update the tail pointer
-        if (current->next == nullptr) {
-            tail = current;  // Update tail to the current node
-        }
+        // Delete the node at the cursor
+        deleteAtCursor();
     }
 
     // Method to delete a node from the beginning (head)
@@ -210,7 +280,8 @@ public:
 
         Node* temp = head;  // Store the current head node in temp
         head = head->next;  // Update the head to the next node
-        delete temp;  // Delete the old head node
+        cursor.reset();  // The old head may be in front of the cursor, so it goes back to the head
+        destroyNode(temp);  // Delete the old head node
 
         // If the list becomes empty after deletion, set tail to nullptr
         if (head == nullptr) {
@@ -228,7 +299,8 @@ public:
 
         // If the list has only one node, delete it
         if (head->next == nullptr) {
-            delete head;  // Delete the only node in the list
+            cursor.reset();  // The cursor can only be in front of this node or on it
+            destroyNode(head);  // Delete the only node in the list
             head = nullptr;  // Set the head to null as the list is now empty
             tail = nullptr;  // Set tail to null as well
             return;  // Exit the function
@@ -243,7 +315,11 @@ public:
         // Delete the last node (current->next is the last node)
         Node* temp = current->next;  // Store the last node in temp
         current->next = nullptr;  // Set the second last node's next to null
-        delete temp;  // Delete the last node
+        // If the cursor was at the end, the deleted node was the last one in front of it
+        if (!cursor.path.empty() && cursor.path.back() == temp) {
+            cursor.path.pop_back();
+        }
+        destroyNode(temp);  // Delete the last node
 
         // Update the tail pointer to the second last node
         tail = current;
@@ -264,6 +340,273 @@ public:
         return false;  // Value not found
     }
 
+    // Method to get the position of the cursor (0 is the head, the length of the list is the end).
+    // insertAtPosition and deleteAtPosition leave the cursor at the position they used;
+    // other changes that can shift the positions in front of it move it back to the head.
+    int cursorPosition() {
+        return cursor.position();
+    }
+
+    // Method to move the cursor k positions toward the end of the list in O(k)
+    void moveForward(int k) {
+        int start = cursor.position();  // Where the cursor is now
+        // A negative distance or one past the end leaves the cursor where it was
+        if (k < 0 || !moveTo(start + k)) {
+            cursor.path.resize(start);  // Undo a partial walk
+            cout << "Cursor out of bounds\n";  // Print an error message
+        }
+    }
+
+    // Method to move the cursor k positions toward the head in O(k)
+    void moveBack(int k) {
+        // A negative distance or one before the head leaves the cursor where it was
+        if (k < 0 || k > cursor.position()) {
+            cout << "Cursor out of bounds\n";  // Print an error message
+            return;
+        }
+        moveTo(cursor.position() - k);  // Drop the last k nodes in front of the cursor
+    }
+
+    // Method to get the element at the cursor
+    int getAtCursor() {
+        Node* node = cursorNode();  // Node the cursor is on
+        // At the end of the list there is no element, so print a message and return
+        if (node == nullptr) {
+            cout << "Cursor is at the end of the list\n";  // Print an error message
+            return -1;  // Return -1 to indicate failure
+        }
+        return node->data;  // Return the element
+    }
+
+    // Method to insert a new node in front of the cursor in O(1); the cursor
+    // stays on the same element, which is now one position further
+    void insertAtCursor(int data) {
+        // Create a new node with the given data
+        Node* newNode = NodeMagazine<Node>::create(data);
+        newNode->next = cursorNode();  // The node at the cursor follows the new node
+        // Link the new node after the last node in front of the cursor, or make it the head
+        if (cursor.path.empty()) {
+            head = newNode;
+        } else {
+            cursor.path.back()->next = newNode;
+        }
+        // If the cursor was at the end, the new node is the new tail
+        if (newNode->next == nullptr) {
+            tail = newNode;
+        }
+        cursor.path.push_back(newNode);  // The new node is now in front of the cursor
+    }
+
+    // Method to delete the node at the cursor in O(1); the cursor moves on to the next element
+    void deleteAtCursor() {
+        Node* temp = cursorNode();  // Node to be deleted
+        // At the end of the list there is nothing to delete, so print a message and return
+        if (temp == nullptr) {
+            cout << "Cursor is at the end of the list\n";  // Print an error message
+            return;
+        }
+        // Bypass the node from the last node in front of the cursor, or from the head
+        if (cursor.path.empty()) {
+            head = temp->next;
+        } else {
+            cursor.path.back()->next = temp->next;
+        }
+        // If the node was the tail, the last node in front of the cursor is the new tail
+        if (temp == tail) {
+            tail = cursor.path.empty() ? nullptr : cursor.path.back();
+        }
+        destroyNode(temp);  // Delete the node
+    }
+
+    // Method to remove every element matching a predicate in a single pass;
+    // returns the number of removed elements
+    template <typename Predicate>
+    int removeIf(Predicate pred) {
+        int removed = 0;  // Number of elements removed so far
+        Node* prev = nullptr;  // Last node that was kept
+        Node* current = head;  // Start from the head node
+        // Visit every node once, unlinking the matching ones
+        while (current != nullptr) {
+            Node* next = current->next;  // Store the next node before a possible delete
+            if (pred(current->data)) {
+                // Bypass the node from the last kept node, or from the head
+                if (prev == nullptr) {
+                    head = next;
+                } else {
+                    prev->next = next;
+                }
+                destroyNode(current);  // Delete the node
+                removed++;  // Count it
+            } else {
+                prev = current;  // This node stays
+            }
+            current = next;  // Move to the next node
+        }
+        tail = prev;  // The last kept node is the new tail
+        // Positions changed, so the cursor goes back to the head
+        if (removed > 0) {
+            cursor.reset();
+        }
+        return removed;  // Return the number of removed elements
+    }
+
+    // Method to remove every occurrence of a value in a single pass;
+    // returns the number of removed elements
+    int removeAll(int value) {
+        return removeIf([value](int data) { return data == value; });  // Match on equality
+    }
+
+    // Method to replace the contents of the list with the given values
+    void assign(const vector<int>& values) {
+        clear();  // Drop the old elements and their memory
+        appendRange(values);  // Add the new ones in one allocation
+    }
+
+    // Method to append all given values, allocating their nodes in one block.
+    // The block is freed when the last of its nodes is deleted.
+    void appendRange(const vector<int>& values) {
+        // Nothing to append for an empty range
+        if (values.empty()) {
+            return;
+        }
+        Node* last;  // Receives the last node of the new chain
+        Node* first = allocateBlock(values, last);  // Create all nodes at once
+        // Link the chain after the tail, or make it the list if the list is empty
+        if (tail == nullptr) {
+            head = first;
+        } else {
+            tail->next = first;
+        }
+        tail = last;  // The end of the chain is the new tail
+    }
+
+    // Method to sort the list in place in O(n log n) by relinking the existing nodes
+    void sort() {
+        // Count the nodes to know when the runs cover the whole list
+        int length = 0;
+        for (Node* current = head; current != nullptr; current = current->next) {
+            length++;  // One more node
+        }
+        Node* last;  // Receives the last node after sorting
+        head = ChainMergeSort<Node>::sortChain(head, length, last);  // Sort and store the new head
+        tail = (head == nullptr) ? nullptr : last;  // The last node is the new tail
+        cursor.reset();  // Nodes changed positions
+    }
+
+    // Method to merge another sorted list into this sorted list without allocating;
+    // the other list is left empty
+    void mergeSorted(LinkedList& other) {
+        // Merging a list with itself would corrupt it
+        if (&other == this) {
+            return;
+        }
+        Node dummy(0);  // Temporary node in front of the merged chain
+        Node* last = ChainMergeSort<Node>::mergeChains(head, other.head, &dummy);  // Merge both chains
+        head = dummy.next;  // The merged chain becomes this list
+        tail = (head == nullptr) ? nullptr : last;  // Its last node is the new tail
+        other.head = nullptr;  // The other list no longer owns any node
+        blocks.insert(blocks.end(), other.blocks.begin(), other.blocks.end());  // Its node blocks move along
+        other.blocks.clear();
+        sortBlocks();  // Keep the lookup in destroyNode valid
+        other.tail = nullptr;
+        cursor.reset();  // Nodes changed positions
+        other.cursor.reset();  // The other list is empty now
+    }
+
+    // Method to move all nodes of another list to the end of this one without
+    // walking either list (only the appendRange block records are merged);
+    // the other list is left empty
+    void splice(LinkedList& other) {
+        // Splicing a list onto itself (or an empty list) changes nothing
+        if (&other == this || other.head == nullptr) {
+            return;
+        }
+        // Link the other chain after the tail, or take it over if this list is empty
+        if (tail == nullptr) {
+            head = other.head;
+        } else {
+            tail->next = other.head;
+        }
+        tail = other.tail;  // The other list's tail is the new tail
+        other.head = nullptr;  // The other list no longer owns any node
+        blocks.insert(blocks.end(), other.blocks.begin(), other.blocks.end());  // Its node blocks move along
+        other.blocks.clear();
+        sortBlocks();  // Keep the lookup in destroyNode valid
+        other.tail = nullptr;
+        other.cursor.reset();  // The other list is empty now
+    }
+
+    // Method to sort a long list on several threads: the list is cut into one
+    // chain per thread, the chains are sorted concurrently, and the sorted
+    // chains are merged pairwise. The thread count is capped by the hardware
+    // concurrency and by the list length, so short lists are sorted on the
+    // calling thread.
+    void parallelSort(int threads) {
+        // Count the nodes
+        int length = 0;
+        for (Node* current = head; current != nullptr; current = current->next) {
+            length++;  // One more node
+        }
+        // No more threads than the hardware runs at once (0 means unknown)
+        int hardwareThreads = (int)thread::hardware_concurrency();
+        if (hardwareThreads > 0 && threads > hardwareThreads) {
+            threads = hardwareThreads;
+        }
+        // Every thread gets a chunk of at least PARALLEL_SORT_MIN_CHUNK nodes
+        if (threads > length / PARALLEL_SORT_MIN_CHUNK) {
+            threads = length / PARALLEL_SORT_MIN_CHUNK;
+        }
+        // With a single chunk the thread start-up costs more than it saves
+        if (threads <= 1) {
+            sort();  // Sort on this thread
+            return;
+        }
+
+        // Cut the list into one chain per thread
+        vector<Node*> chains(threads);  // First node of each chain
+        vector<int> lengths(threads);  // Length of each chain
+        vector<Node*> lasts(threads);  // Last node of each chain after sorting
+        Node* current = head;
+        for (int i = 0; i < threads; i++) {
+            lengths[i] = length / threads + (i < length % threads ? 1 : 0);  // Spread the remainder
+            chains[i] = current;  // This chain starts here
+            current = ChainMergeSort<Node>::splitAfter(current, lengths[i]);  // And ends after lengths[i] nodes
+        }
+
+        // Sort every chain on its own thread
+        vector<thread> workers;
+        for (int i = 0; i < threads; i++) {
+            workers.push_back(thread([&chains, &lengths, &lasts, i]() {
+                chains[i] = ChainMergeSort<Node>::sortChain(chains[i], lengths[i], lasts[i]);
+            }));
+        }
+        // Wait for all sorts to finish
+        for (size_t i = 0; i < workers.size(); i++) {
+            workers[i].join();
+        }
+
+        // Merge the sorted chains pairwise until one chain is left
+        for (int step = 1; step < threads; step *= 2) {
+            for (int i = 0; i + step < threads; i += 2 * step) {
+                Node dummy(0);  // Temporary node in front of the merged chain
+                lasts[i] = ChainMergeSort<Node>::mergeChains(chains[i], chains[i + step], &dummy);  // Merge the neighbours
+                chains[i] = dummy.next;  // The merged chain replaces the left one
+            }
+        }
+        head = chains[0];  // The fully merged chain is the list
+        tail = lasts[0];  // And its last node is the tail
+        cursor.reset();  // Nodes changed positions
+    }
+
+    // Method to get the number of bytes held by node blocks from appendRange
+    size_t blockMemoryBytes() {
+        size_t bytes = 0;
+        for (size_t i = 0; i < blocks.size(); i++) {
+            bytes += blocks[i].size * sizeof(Node);  // Freed only with its last node
+        }
+        return bytes;
+    }
+
     // Method to print all elements in the list
     void printList() {
         // Start from the head and traverse the list
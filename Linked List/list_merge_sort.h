@@ -0,0 +1,70 @@
+#ifndef LIST_MERGE_SORT_H
+#define LIST_MERGE_SORT_H
+
+// ChainMergeSort class: merge sort on singly linked chains, shared by the
+// linked list classes. NodeT needs an int data field, a NodeT* next field and
+// a constructor taking an int. All functions relink nodes in place; no node is
+// created or freed (the dummy nodes live on the stack).
+template <typename NodeT>
+class ChainMergeSort {
+public:
+    // Helper to cut a chain after count nodes and return the rest of it
+    static NodeT* splitAfter(NodeT* start, int count) {
+        // Walk to the last node that stays in the first part
+        for (int i = 1; start != nullptr && i < count; i++) {
+            start = start->next;  // Move to the next node
+        }
+        // If the chain is shorter than count, nothing is left over
+        if (start == nullptr) {
+            return nullptr;
+        }
+        NodeT* rest = start->next;  // First node of the remainder
+        start->next = nullptr;  // Cut the chain
+        return rest;  // Return the remainder
+    }
+
+    // Helper to merge two sorted chains after the node attach; returns the last merged node
+    static NodeT* mergeChains(NodeT* left, NodeT* right, NodeT* attach) {
+        // Repeatedly move the smaller front node to the merged chain (left first on ties, so the sort is stable)
+        while (left != nullptr && right != nullptr) {
+            if (left->data <= right->data) {
+                attach->next = left;  // Link the left node
+                left = left->next;  // Advance in the left chain
+            } else {
+                attach->next = right;  // Link the right node
+                right = right->next;  // Advance in the right chain
+            }
+            attach = attach->next;  // Move to the newly linked node
+        }
+        // Link whatever remains of either chain
+        attach->next = (left != nullptr) ? left : right;
+        // Walk to the end of the remainder to find the last node
+        while (attach->next != nullptr) {
+            attach = attach->next;
+        }
+        return attach;  // Return the last node of the merged chain
+    }
+
+    // Helper to sort a chain of length nodes in place by bottom-up merge sort;
+    // returns the new first node and stores the new last node in last
+    static NodeT* sortChain(NodeT* first, int length, NodeT*& last) {
+        NodeT dummy(0);  // Temporary node in front of the chain
+        dummy.next = first;  // Link the chain after it
+        last = first;  // A chain of 0 or 1 nodes is already sorted
+        // Merge runs of width 1, 2, 4, ... until one run covers the whole chain
+        for (int width = 1; width < length; width *= 2) {
+            NodeT* attach = &dummy;  // Node after which the next merged run goes
+            NodeT* current = dummy.next;  // Start of the unmerged part
+            while (current != nullptr) {
+                NodeT* left = current;  // First run
+                NodeT* right = splitAfter(left, width);  // Second run
+                current = splitAfter(right, width);  // Rest of the chain
+                attach = mergeChains(left, right, attach);  // Merge the two runs into place
+            }
+            last = attach;  // The last merged node ends the chain
+        }
+        return dummy.next;  // Return the new first node
+    }
+};
+
+#endif
@@ -0,0 +1,170 @@
+#include <iostream>
+#include <atomic>
+#include <mutex>
+using namespace std;
+
+// Node class to represent a single immutable node of the persistent list
+class Node {
+public:
+    const int data;           // Data stored in the node (never changes)
+    Node* const next;         // Pointer to the next node (never changes)
+    const int length;         // Number of nodes from this one to the end of the list
+    atomic<int> refCount;     // Number of list versions and nodes that point to this node
+
+    // Constructor to initialize a node in front of an existing chain
+    Node(int data, Node* next) : data(data), next(next), length(next == nullptr ? 1 : next->length + 1) {
+        this->refCount.store(1, memory_order_relaxed);  // The creator holds the first reference
+    }
+};
+
+// PersistentList class: an immutable singly linked list. pushFront and pop do
+// not change the list; they return a new version that shares every other node
+// with the old one. Copying a version (taking a snapshot) is O(1): it only
+// increments a reference count. Nodes are reference counted with atomic
+// counters, so versions can be handed to other threads, and a node is freed
+// as soon as no version can reach it.
+class PersistentList {
+private:
+    Node* head;  // Pointer to the head (first node) of this version
+
+    // Helper to add a reference to a chain
+    static void retain(Node* node) {
+        // A null chain needs no reference
+        if (node != nullptr) {
+            node->refCount.fetch_add(1, memory_order_relaxed);  // Relaxed is enough: the caller already holds a reference
+        }
+    }
+
+    // Helper to drop a reference to a chain, freeing the nodes that become unreachable.
+    // Iterative, so releasing a long list cannot overflow the call stack.
+    static void release(Node* node) {
+        // Walk down while this was the last reference to the node
+        while (node != nullptr && node->refCount.fetch_sub(1, memory_order_acq_rel) == 1) {
+            Node* next = node->next;  // Store the next node before deleting the current one
+            delete node;  // Nobody can reach this node any more
+            node = next;  // The deleted node's reference to next is dropped as well
+        }
+    }
+
+    // Constructor to wrap a chain whose reference the new version takes over
+    explicit PersistentList(Node* head) {
+        this->head = head;  // Take ownership of the reference
+    }
+
+public:
+    // Constructor to initialize an empty list
+    PersistentList() {
+        head = nullptr;  // Set the head to nullptr indicating the list is empty
+    }
+
+    // Copy constructor: an O(1) snapshot sharing all nodes
+    PersistentList(const PersistentList& other) {
+        head = other.head;  // Share the same chain
+        retain(head);  // And hold a reference to it
+    }
+
+    // Copy assignment: drop the old chain and share the other one
+    PersistentList& operator=(const PersistentList& other) {
+        retain(other.head);  // Take the new reference first (safe for self-assignment)
+        release(head);  // Then drop the old one
+        head = other.head;  // Share the other chain
+        return *this;
+    }
+
+    // Destructor to drop this version's reference
+    ~PersistentList() {
+        release(head);  // Frees every node no other version uses
+    }
+
+    // Method to check whether the list is empty
+    bool isEmpty() const {
+        return head == nullptr;  // No head node means no elements
+    }
+
+    // Method to get the number of elements in O(1)
+    int size() const {
+        return head == nullptr ? 0 : head->length;  // Every node knows its length
+    }
+
+    // Method to get the first element
+    int front() const {
+        // If the list is empty, print a message and return
+        if (head == nullptr) {
+            cout << "List is empty\n";  // Print an error message
+            return -1;  // Return -1 to indicate failure
+        }
+        return head->data;  // Return the head's data
+    }
+
+    // Method to get a new version with data in front; this version is unchanged
+    PersistentList pushFront(int data) const {
+        retain(head);  // The new node will point to (and reference) the current chain
+        return PersistentList(new Node(data, head));  // The new version owns the new node
+    }
+
+    // Method to get a new version without the first element; this version is unchanged
+    PersistentList pop() const {
+        // If the list is empty, print a message and return another empty version
+        if (head == nullptr) {
+            cout << "List is empty\n";  // Print an error message
+            return PersistentList();
+        }
+        retain(head->next);  // The new version references the rest of the chain
+        return PersistentList(head->next);
+    }
+
+    // Method to search for a value in the list
+    bool search(int value) const {
+        // Traverse the list to look for the value
+        const Node* current = head;
+        while (current != nullptr) {
+            // If the value is found, return true
+            if (current->data == value) {
+                return true;  // Value found
+            }
+            current = current->next;  // Move to the next node
+        }
+        // If the value is not found, return false
+        return false;  // Value not found
+    }
+
+    // Method to print all elements in the list
+    void printList() const {
+        // Start from the head and traverse the list
+        const Node* current = head;
+        while (current != nullptr) {
+            // Print the data of the current node
+            cout << current->data << " -> ";  // Display the current node's data
+            current = current->next;  // Move to the next node
+        }
+        // Print null to indicate the end of the list
+        cout << "null\n";  // Indicate the end of the list
+    }
+};
+
+// VersionCell class: the shared place where a writer publishes the latest
+// version and readers take snapshots of it. The lock is only held while
+// copying one pointer and bumping a counter, so a snapshot is O(1) and never
+// waits for the writer to build its next version.
+class VersionCell {
+private:
+    mutable mutex lock;        // Protects the current version while it is copied or replaced
+    PersistentList current;    // Latest published version
+
+public:
+    // Method to publish a new version
+    void publish(const PersistentList& version) {
+        PersistentList old;  // Receives the previous version so it is released outside the lock
+        {
+            lock_guard<mutex> guard(lock);
+            old = current;  // Keep the previous version alive until the lock is dropped
+            current = version;  // Install the new version
+        }
+    }
+
+    // Method to take an O(1) snapshot of the latest version
+    PersistentList snapshot() const {
+        lock_guard<mutex> guard(lock);
+        return current;  // Copying only bumps a reference count
+    }
+};
@@ -0,0 +1,300 @@
+#include <iostream>
+#include <cstring>
+using namespace std;
+
+// Number of elements per node, chosen so one node fills exactly two 64-byte cache lines
+const int NODE_CAPACITY = (128 - sizeof(void*) - sizeof(int)) / sizeof(int);
+
+// Node class to represent one block of the unrolled linked list
+class alignas(64) Node {
+public:
+    Node* next;                 // Pointer to the next node in the list
+    int count;                  // Number of elements currently stored in this node
+    int data[NODE_CAPACITY];    // Elements stored in the node, in list order
+
+    // Constructor to initialize an empty node with a null next pointer
+    Node() {
+        this->next = nullptr;  // Set the next pointer to null (no next node yet)
+        this->count = 0;  // The node starts without elements
+    }
+};
+
+// UnrolledLinkedList class: the LinkedList API with many elements per node.
+// Walking the list touches one node per NODE_CAPACITY elements instead of one
+// per element, and each node is two cache lines scanned sequentially.
+// Nodes split in half when an insert finds them full, and a node that drops
+// below half full borrows from or merges with its successor.
+class UnrolledLinkedList {
+private:
+    Node* head;  // Pointer to the head (first node) of the list
+    Node* tail;  // Pointer to the tail (last node) of the list
+    int size;    // Total number of elements in the list
+
+    // Find the node holding the given position; sets prev and the index inside the node
+    Node* findPosition(int position, Node*& prev, int& index) {
+        prev = nullptr;  // There is no node before the head
+        Node* current = head;  // Start from the head node
+        // Skip whole nodes until the position falls inside the current one
+        while (current != nullptr && position >= current->count) {
+            position -= current->count;  // Skip all elements of this node
+            prev = current;  // Remember the previous node
+            current = current->next;  // Move to the next node
+        }
+        index = position;  // Remaining offset is the index inside the node
+        return current;  // Null if the position is past the last element
+    }
+
+    // Split a full node, moving its upper half into a new node after it
+    void split(Node* node) {
+        Node* newNode = new Node();  // Create the node that takes the upper half
+        int half = node->count / 2;  // Number of elements the old node keeps
+        newNode->count = node->count - half;  // The rest go to the new node
+        memcpy(newNode->data, node->data + half, newNode->count * sizeof(int));  // Copy the upper half
+        node->count = half;  // Shrink the old node
+        newNode->next = node->next;  // Link the new node after the old one
+        node->next = newNode;
+        // If the old node was the tail, the new node is the tail now
+        if (tail == node) {
+            tail = newNode;
+        }
+    }
+
+    // Insert a value at an index inside a node, splitting the node first if it is full
+    void insertIntoNode(Node* node, int index, int data) {
+        // Make room by splitting a full node
+        if (node->count == NODE_CAPACITY) {
+            split(node);  // Upper half moves to node->next
+            // If the index now lies in the new node, continue there
+            if (index > node->count) {
+                index -= node->count;  // Offset inside the new node
+                node = node->next;  // Switch to the new node
+            }
+        }
+        // Shift the elements after the index one slot to the right
+        memmove(node->data + index + 1, node->data + index, (node->count - index) * sizeof(int));
+        node->data[index] = data;  // Store the new element
+        node->count++;  // One more element in this node
+        size++;  // One more element in the list
+    }
+
+    // Remove the element at an index inside a node and rebalance the node
+    void removeFromNode(Node* prev, Node* node, int index) {
+        // Shift the elements after the index one slot to the left
+        memmove(node->data + index, node->data + index + 1, (node->count - index - 1) * sizeof(int));
+        node->count--;  // One element less in this node
+        size--;  // One element less in the list
+
+        // Rebalance a node that fell below half full and has a successor
+        Node* next = node->next;
+        if (node->count < NODE_CAPACITY / 2 && next != nullptr) {
+            // Merge the successor into this node if both fit
+            if (node->count + next->count <= NODE_CAPACITY) {
+                memcpy(node->data + node->count, next->data, next->count * sizeof(int));  // Append its elements
+                node->count += next->count;  // This node now holds both
+                node->next = next->next;  // Bypass the successor
+                // If the successor was the tail, this node is the tail now
+                if (tail == next) {
+                    tail = node;
+                }
+                delete next;  // Delete the emptied successor
+            } else {
+                // Otherwise borrow elements from the successor until both are about half full
+                int moved = (next->count - node->count) / 2;  // Number of elements to borrow
+                memcpy(node->data + node->count, next->data, moved * sizeof(int));  // Take its first elements
+                memmove(next->data, next->data + moved, (next->count - moved) * sizeof(int));  // Close the gap
+                node->count += moved;  // This node gained them
+                next->count -= moved;  // The successor lost them
+            }
+        }
+
+        // Unlink a node that became empty (only possible when it has no successor)
+        if (node->count == 0) {
+            // Bypass the node from the previous node or the head
+            if (prev == nullptr) {
+                head = node->next;
+            } else {
+                prev->next = node->next;
+            }
+            // If the node was the tail, the previous node is the tail now
+            if (tail == node) {
+                tail = prev;
+            }
+            delete node;  // Delete the empty node
+        }
+    }
+
+public:
+    // Constructor to initialize an empty linked list
+    UnrolledLinkedList() {
+        head = nullptr;  // Set the head to nullptr indicating the list is empty
+        tail = nullptr;  // Set the tail to nullptr indicating the list is empty
+        size = 0;  // The list holds no elements yet
+    }
+
+    // Destructor to free all allocated memory when the list is destroyed
+    ~UnrolledLinkedList() {
+        Node* current = head;  // Start from the head node
+        // Iterate through all nodes and delete them
+        while (current != nullptr) {
+            Node* temp = current->next;  // Store the next node before deleting the current one
+            delete current;  // Delete the current node to free memory
+            current = temp;  // Move to the next node
+        }
+    }
+
+    // Method to get the number of elements in the list
+    int getSize() {
+        return size;  // Return the element count
+    }
+
+    // Method to insert a new element at the beginning of the list
+    void insertAtHead(int data) {
+        insertAtPosition(0, data);  // Position 0 is the head
+    }
+
+    // Method to insert a new element at the end of the list
+    void insertAtTail(int data) {
+        // Start a new node if the list is empty or the tail node is full
+        if (tail == nullptr || tail->count == NODE_CAPACITY) {
+            Node* newNode = new Node();  // Create the new tail node
+            // Link it after the current tail, or make it the head of an empty list
+            if (tail == nullptr) {
+                head = newNode;
+            } else {
+                tail->next = newNode;
+            }
+            tail = newNode;  // Update the tail to the new node
+        }
+        tail->data[tail->count++] = data;  // Append the element to the tail node
+        size++;  // One more element in the list
+    }
+
+    // Method to insert a new element at a specific position
+    void insertAtPosition(int position, int data) {
+        // If position is invalid (out of bounds), print a message and return
+        if (position < 0 || position > size) {
+            cout << "Position out of bounds\n";  // Print an error message
+            return;
+        }
+        // Inserting after the last element is an append
+        if (position == size) {
+            insertAtTail(data);  // Append at the tail
+            return;
+        }
+        // Find the node holding the position and insert inside it
+        Node* prev;
+        int index;
+        Node* node = findPosition(position, prev, index);
+        insertIntoNode(node, index, data);
+    }
+
+    // Method to delete an element by value (first occurrence)
+    void deleteByValue(int value) {
+        // If the list is empty, print a message and return
+        if (head == nullptr) {
+            cout << "List is empty\n";  // Print an error message
+            return;  // Exit the function
+        }
+
+        // Scan every node for the value
+        Node* prev = nullptr;
+        for (Node* current = head; current != nullptr; current = current->next) {
+            // Scan the elements of the current node
+            for (int i = 0; i < current->count; i++) {
+                // Remove the first match and stop
+                if (current->data[i] == value) {
+                    removeFromNode(prev, current, i);
+                    return;
+                }
+            }
+            prev = current;  // Remember the previous node
+        }
+
+        // If the value is not found, print a message
+        cout << "Value not found in the list\n";  // Print an error message
+    }
+
+    // Method to delete an element at a specific position
+    void deleteAtPosition(int position) {
+        // If the list is empty, print a message and return
+        if (head == nullptr) {
+            cout << "List is empty\n";  // Print an error message
+            return;  // Exit the function
+        }
+
+        // If position is invalid (out of bounds), print a message and return
+        if (position < 0 || position >= size) {
+            cout << "Position out of bounds\n";  // Print an error message
+            return;  // Exit the function
+        }
+
+        // Find the node holding the position and remove the element from it
+        Node* prev;
+        int index;
+        Node* node = findPosition(position, prev, index);
+        removeFromNode(prev, node, index);
+    }
+
+    // Method to delete the element at the beginning (head)
+    void deleteFromBeginning() {
+        // If the list is empty, print a message and return
+        if (head == nullptr) {
+            cout << "List is empty\n";  // Print an error message
+            return;  // Exit the function
+        }
+        removeFromNode(nullptr, head, 0);  // Remove the first element of the head node
+    }
+
+    // Method to delete the element at the end (tail)
+    void deleteFromEnd() {
+        // If the list is empty, print a message and return
+        if (head == nullptr) {
+            cout << "List is empty\n";  // Print an error message
+            return;  // Exit the function
+        }
+        deleteAtPosition(size - 1);  // The last position is in the tail node
+    }
+
+    // Method to search for a value in the list
+    bool search(int value) {
+        // Traverse the nodes to look for the value
+        for (Node* current = head; current != nullptr; current = current->next) {
+            // Scan the contiguous elements of the current node
+            for (int i = 0; i < current->count; i++) {
+                // If the value is found, return true
+                if (current->data[i] == value) {
+                    return true;  // Value found
+                }
+            }
+        }
+        // If the value is not found, return false
+        return false;  // Value not found
+    }
+
+    // Method to get the average number of bytes used per element
+    double bytesPerElement() {
+        // An empty list has no per-element cost
+        if (size == 0) {
+            return 0;
+        }
+        // Count the nodes and divide their memory by the number of elements
+        int nodes = 0;
+        for (Node* current = head; current != nullptr; current = current->next) {
+            nodes++;
+        }
+        return (double)nodes * sizeof(Node) / size;
+    }
+
+    // Method to print all elements in the list
+    void printList() {
+        // Start from the head and traverse every node
+        for (Node* current = head; current != nullptr; current = current->next) {
+            // Print the data of every element in the node
+            for (int i = 0; i < current->count; i++) {
+                cout << current->data[i] << " -> ";  // Display the element
+            }
+        }
+        // Print null to indicate the end of the list
+        cout << "null\n";  // Indicate the end of the list
+    }
+};
@@ -0,0 +1,602 @@
+#include <iostream>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+using namespace std;
+
+// Eviction policies of the cache
+enum CacheMode { PLAIN_LRU, SEGMENTED_LRU, LFU };
+
+template <typename K, typename V>
+class FrequencyBucket;
+
+// Define a CacheNode class: a doubly linked list node (as in queue_doubly_linked_list.cpp and deque.cpp)
+// that carries a key/value pair
+template <typename K, typename V>
+class CacheNode {
+public:
+    // Key of the cached entry
+    K key;
+    // Value of the cached entry
+    V value;
+    // Hash of the key, kept so the index never has to rehash it
+    size_t hash;
+    // Segment the node is linked into (0 = probation, 1 = protected)
+    int segment;
+    // Bucket of nodes with the same use count the node is linked into (LFU mode only)
+    FrequencyBucket<K, V>* bucket;
+    // Pointer to the next (less recently used) node in the list
+    CacheNode* next;
+    // Pointer to the previous (more recently used) node in the list
+    CacheNode* prev;
+
+    // Constructor to initialize an unlinked node
+    CacheNode() {
+        // Start with no hash and in the probation segment
+        this->hash = 0;
+        this->segment = 0;
+        this->bucket = nullptr;
+        // Initialize next and prev pointers to null as the node is not linked yet
+        this->next = nullptr;
+        this->prev = nullptr;
+    }
+};
+
+// Define a FrequencyBucket class: the nodes used the same number of times, as
+// a doubly linked list from most to least recently used. The buckets form a
+// doubly linked list of their own, ordered by increasing use count.
+template <typename K, typename V>
+class FrequencyBucket {
+public:
+    // Use count shared by every node in the bucket
+    uint64_t frequency;
+    // Most recently used node in the bucket
+    CacheNode<K, V>* front;
+    // Least recently used node in the bucket
+    CacheNode<K, V>* rear;
+    // Pointer to the bucket with the next higher use count
+    FrequencyBucket* next;
+    // Pointer to the bucket with the next lower use count
+    FrequencyBucket* prev;
+
+    // Constructor to initialize an empty, unlinked bucket
+    FrequencyBucket() {
+        this->frequency = 0;
+        this->front = nullptr;
+        this->rear = nullptr;
+        this->next = nullptr;
+        this->prev = nullptr;
+    }
+};
+
+// Define an LRUCache class: a fixed-capacity cache with O(1) get, put and eviction.
+// Entries live in doubly linked lists ordered from most to least recently used,
+// and an open-addressing hash index (linear probing with backward-shift
+// deletion) maps each key straight to its node. All nodes come from a pool
+// allocated up front, so a warm cache never allocates.
+//
+// In segmented mode (SLRU) new entries enter a probation segment and are only
+// promoted to the protected segment (80% of the capacity) when hit again, so
+// one-off scans evict each other instead of the frequently used entries.
+//
+// In LFU mode the entry used the fewest times is evicted, the least recently
+// used one among equals. Nodes sit in frequency buckets and a use moves a node
+// to the bucket one count higher, so every operation stays O(1); the buckets
+// come from a second pool (there are never more buckets than entries).
+template <typename K, typename V>
+class LRUCache {
+private:
+    // Pool holding every node the cache can ever use
+    vector<CacheNode<K, V> > pool;
+    // First node of the list of unused pool nodes (linked through next)
+    CacheNode<K, V>* freeNodes;
+    // Hash index: each slot is empty (nullptr) or points to a cached node
+    vector<CacheNode<K, V>*> slots;
+    // Mask used instead of the modulo operation (slots.size() - 1)
+    size_t mask;
+    // Most recently used node of each segment
+    CacheNode<K, V>* front[2];
+    // Least recently used node of each segment
+    CacheNode<K, V>* rear[2];
+    // Number of nodes in each segment
+    int count[2];
+    // Maximum number of entries
+    int capacity;
+    // Maximum number of entries in the protected segment (0 in plain LRU and LFU mode)
+    int protectedCapacity;
+    // Eviction policy
+    CacheMode mode;
+    // Pool holding every frequency bucket the cache can use (empty unless in LFU mode)
+    vector<FrequencyBucket<K, V> > bucketPool;
+    // First bucket of the list of unused buckets (linked through next)
+    FrequencyBucket<K, V>* freeBuckets;
+    // Bucket with the lowest use count (its rear node is the LFU victim)
+    FrequencyBucket<K, V>* lowestBucket;
+    // Counters for hit rate and throughput reporting
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+    uint64_t puts;
+
+    // Mix the key's hash so that keys with similar std::hash values spread out
+    static size_t hashKey(const K& key) {
+        // Start from the standard hash (identity for integers)
+        uint64_t h = (uint64_t)std::hash<K>()(key);
+        // Finalizer of MurmurHash3 to spread the bits
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ULL;
+        h ^= h >> 33;
+        return (size_t)h;
+    }
+
+    // Find the index slot holding the key, or the empty slot where it would go
+    size_t findSlot(const K& key, size_t hash) {
+        // Start at the key's home slot
+        size_t i = hash & mask;
+        // Probe forward until the key or an empty slot is found
+        while (slots[i] != nullptr && !(slots[i]->hash == hash && slots[i]->key == key)) {
+            i = (i + 1) & mask;
+        }
+        return i;
+    }
+
+    // Remove the entry in slot i from the index, shifting later entries back
+    // so that no probe sequence is broken (no tombstones needed)
+    void eraseSlot(size_t i) {
+        size_t j = i;
+        while (true) {
+            // Look at the next slot
+            j = (j + 1) & mask;
+            // An empty slot ends the cluster
+            if (slots[j] == nullptr) {
+                break;
+            }
+            // Home slot of the entry found there
+            size_t home = slots[j]->hash & mask;
+            // The entry can move into the hole only if its home is not between the hole and it
+            bool homeBetween = (i <= j) ? (i < home && home <= j) : (i < home || home <= j);
+            if (!homeBetween) {
+                // Move it back and continue with its old slot as the hole
+                slots[i] = slots[j];
+                i = j;
+            }
+        }
+        // Clear the final hole
+        slots[i] = nullptr;
+    }
+
+    // Unlink a node from its segment list
+    void unlink(CacheNode<K, V>* node) {
+        int s = node->segment;
+        // Bypass the node from its previous node, or move the front
+        if (node->prev != nullptr) {
+            node->prev->next = node->next;
+        } else {
+            front[s] = node->next;
+        }
+        // Bypass the node from its next node, or move the rear
+        if (node->next != nullptr) {
+            node->next->prev = node->prev;
+        } else {
+            rear[s] = node->prev;
+        }
+        // The segment has one node less
+        count[s]--;
+    }
+
+    // Link a node at the front (most recently used end) of a segment list
+    void pushFront(CacheNode<K, V>* node, int s) {
+        // Put the node in front of the current front node
+        node->segment = s;
+        node->prev = nullptr;
+        node->next = front[s];
+        // If the segment is empty, the node is also its rear
+        if (front[s] != nullptr) {
+            front[s]->prev = node;
+        } else {
+            rear[s] = node;
+        }
+        front[s] = node;
+        // The segment has one node more
+        count[s]++;
+    }
+
+    // Take an unused bucket for the given use count and link it in after the
+    // bucket after (or as the lowest bucket if after is nullptr)
+    FrequencyBucket<K, V>* newBucket(uint64_t frequency, FrequencyBucket<K, V>* after) {
+        FrequencyBucket<K, V>* bucket = freeBuckets;
+        freeBuckets = bucket->next;
+        bucket->frequency = frequency;
+        bucket->front = nullptr;
+        bucket->rear = nullptr;
+        bucket->prev = after;
+        bucket->next = (after != nullptr) ? after->next : lowestBucket;
+        if (bucket->next != nullptr) {
+            bucket->next->prev = bucket;
+        }
+        if (after != nullptr) {
+            after->next = bucket;
+        } else {
+            lowestBucket = bucket;
+        }
+        return bucket;
+    }
+
+    // Unlink a node from its frequency bucket; a bucket left empty is returned to the pool
+    void unlinkFromBucket(CacheNode<K, V>* node) {
+        FrequencyBucket<K, V>* bucket = node->bucket;
+        // Bypass the node inside the bucket
+        if (node->prev != nullptr) {
+            node->prev->next = node->next;
+        } else {
+            bucket->front = node->next;
+        }
+        if (node->next != nullptr) {
+            node->next->prev = node->prev;
+        } else {
+            bucket->rear = node->prev;
+        }
+        node->bucket = nullptr;
+        // Drop the bucket if it has no nodes left
+        if (bucket->front == nullptr) {
+            if (bucket->prev != nullptr) {
+                bucket->prev->next = bucket->next;
+            } else {
+                lowestBucket = bucket->next;
+            }
+            if (bucket->next != nullptr) {
+                bucket->next->prev = bucket->prev;
+            }
+            bucket->next = freeBuckets;
+            freeBuckets = bucket;
+        }
+    }
+
+    // Link a node at the front (most recently used end) of a frequency bucket
+    void pushFrontOfBucket(CacheNode<K, V>* node, FrequencyBucket<K, V>* bucket) {
+        node->bucket = bucket;
+        node->prev = nullptr;
+        node->next = bucket->front;
+        if (bucket->front != nullptr) {
+            bucket->front->prev = node;
+        } else {
+            bucket->rear = node;
+        }
+        bucket->front = node;
+    }
+
+    // Count one more use of a node: move it to the bucket one count higher
+    void touchFrequency(CacheNode<K, V>* node) {
+        FrequencyBucket<K, V>* bucket = node->bucket;
+        FrequencyBucket<K, V>* higher = bucket->next;
+        uint64_t frequency = bucket->frequency + 1;
+        // Alone in its bucket with no bucket for the next count: just raise the bucket's count
+        if (bucket->front == bucket->rear && (higher == nullptr || higher->frequency != frequency)) {
+            bucket->frequency = frequency;
+            return;
+        }
+        // Otherwise make sure the next count has a bucket (the old one keeps other nodes
+        // in this case, so the pool cannot run out), then move the node over
+        if (higher == nullptr || higher->frequency != frequency) {
+            higher = newBucket(frequency, bucket);
+        }
+        unlinkFromBucket(node);
+        pushFrontOfBucket(node, higher);
+    }
+
+    // Mark a node as used according to the eviction policy
+    void touch(CacheNode<K, V>* node) {
+        // LFU counts the use
+        if (mode == LFU) {
+            touchFrequency(node);
+            return;
+        }
+        // Move the node to the front; in SLRU mode a probation hit is promoted
+        unlink(node);
+        if (protectedCapacity > 0 && node->segment == 0) {
+            pushFront(node, 1);
+            // If the protected segment overflows, demote its LRU entry to probation
+            if (count[1] > protectedCapacity) {
+                CacheNode<K, V>* demoted = rear[1];
+                unlink(demoted);
+                pushFront(demoted, 0);
+            }
+        } else {
+            pushFront(node, node->segment);
+        }
+    }
+
+    // Remove a node from whichever list the eviction policy keeps it in
+    void detach(CacheNode<K, V>* node) {
+        if (mode == LFU) {
+            unlinkFromBucket(node);
+            count[0]--;
+        } else {
+            unlink(node);
+        }
+    }
+
+    // Evict the least recently used entry (from probation first), or in LFU
+    // mode the least recently used of the least frequently used entries
+    void evict() {
+        // Pick the victim: the rear of the lowest bucket, of probation if it has entries,
+        // or of the protected segment
+        CacheNode<K, V>* victim;
+        if (mode == LFU) {
+            victim = lowestBucket->rear;
+        } else {
+            victim = rear[(count[0] > 0) ? 0 : 1];
+        }
+        // Remove it from the index and its list
+        eraseSlot(findSlot(victim->key, victim->hash));
+        detach(victim);
+        // Return the node to the pool
+        victim->next = freeNodes;
+        freeNodes = victim;
+        evictions++;
+    }
+
+public:
+    // Constructor to initialize the cache with the given eviction policy
+    LRUCache(int capacity, CacheMode mode = PLAIN_LRU) {
+        // Always keep room for at least one entry
+        if (capacity < 1) {
+            capacity = 1;
+        }
+        this->capacity = capacity;
+        this->mode = mode;
+        // In SLRU mode the protected segment takes 80% of the capacity
+        this->protectedCapacity = (mode == SEGMENTED_LRU) ? capacity * 4 / 5 : 0;
+        // In LFU mode preallocate one bucket per entry and chain them into the bucket free list
+        freeBuckets = nullptr;
+        lowestBucket = nullptr;
+        if (mode == LFU) {
+            bucketPool.resize(capacity);
+            for (int i = capacity - 1; i >= 0; i--) {
+                bucketPool[i].next = freeBuckets;
+                freeBuckets = &bucketPool[i];
+            }
+        }
+        // Preallocate every node and chain them all into the free list
+        pool.resize(capacity);
+        freeNodes = nullptr;
+        for (int i = capacity - 1; i >= 0; i--) {
+            pool[i].next = freeNodes;
+            freeNodes = &pool[i];
+        }
+        // Size the index to a power of two at least twice the capacity (load factor <= 0.5)
+        size_t tableSize = 2;
+        while (tableSize < (size_t)capacity * 2) {
+            tableSize <<= 1;
+        }
+        slots.assign(tableSize, nullptr);
+        mask = tableSize - 1;
+        // Both segments start empty
+        for (int s = 0; s < 2; s++) {
+            front[s] = nullptr;
+            rear[s] = nullptr;
+            count[s] = 0;
+        }
+        // Reset the counters
+        hits = misses = evictions = puts = 0;
+    }
+
+    // Look up a key; on a hit, copy its value to out, mark it as recently used and return true
+    bool get(const K& key, V& out) {
+        // Find the key in the index
+        size_t hash = hashKey(key);
+        CacheNode<K, V>* node = slots[findSlot(key, hash)];
+        // Report a miss if it is absent
+        if (node == nullptr) {
+            misses++;
+            return false;
+        }
+        hits++;
+        // Mark it as used
+        touch(node);
+        // Return the value
+        out = node->value;
+        return true;
+    }
+
+    // Insert or update a key, evicting an entry chosen by the policy if the cache is full
+    void put(const K& key, const V& value) {
+        puts++;
+        // Find the key in the index
+        size_t hash = hashKey(key);
+        size_t slot = findSlot(key, hash);
+        CacheNode<K, V>* node = slots[slot];
+        // An existing key just gets the new value and moves to the front of its segment
+        // (in LFU mode the update counts as a use)
+        if (node != nullptr) {
+            node->value = value;
+            if (mode == LFU) {
+                touchFrequency(node);
+            } else {
+                unlink(node);
+                pushFront(node, node->segment);
+            }
+            return;
+        }
+        // Make room if every node is in use (this may move entries in the index)
+        if (freeNodes == nullptr) {
+            evict();
+            slot = findSlot(key, hash);
+        }
+        // Take a node from the pool and fill it
+        node = freeNodes;
+        freeNodes = node->next;
+        node->key = key;
+        node->value = value;
+        node->hash = hash;
+        // Index it
+        slots[slot] = node;
+        // In LFU mode it joins the bucket for a single use, which is always the lowest one
+        if (mode == LFU) {
+            FrequencyBucket<K, V>* bucket = lowestBucket;
+            if (bucket == nullptr || bucket->frequency != 1) {
+                bucket = newBucket(1, nullptr);
+            }
+            pushFrontOfBucket(node, bucket);
+            count[0]++;
+            return;
+        }
+        // Otherwise link it at the front of probation
+        pushFront(node, 0);
+    }
+
+    // Remove a key from the cache; returns false if it was not cached
+    bool erase(const K& key) {
+        // Find the key in the index
+        size_t hash = hashKey(key);
+        size_t slot = findSlot(key, hash);
+        CacheNode<K, V>* node = slots[slot];
+        if (node == nullptr) {
+            return false;
+        }
+        // Remove it from the index and its list and return it to the pool
+        eraseSlot(slot);
+        detach(node);
+        node->next = freeNodes;
+        freeNodes = node;
+        return true;
+    }
+
+    // Get the number of cached entries
+    int size() {
+        return count[0] + count[1];
+    }
+
+    // Counter accessors for hit-rate and throughput reporting
+    uint64_t getHits() { return hits; }
+    uint64_t getMisses() { return misses; }
+    uint64_t getEvictions() { return evictions; }
+    uint64_t getOperations() { return hits + misses + puts; }
+
+    // Get the fraction of lookups that were hits
+    double hitRate() {
+        uint64_t lookups = hits + misses;
+        return lookups == 0 ? 0.0 : (double)hits / lookups;
+    }
+
+    // Print the cached keys of each segment (or in LFU mode each use count)
+    // from most to least recently used
+    void printCache() {
+        if (mode == LFU) {
+            for (FrequencyBucket<K, V>* bucket = lowestBucket; bucket != nullptr; bucket = bucket->next) {
+                cout << "Used " << bucket->frequency << "x: ";
+                for (CacheNode<K, V>* node = bucket->front; node != nullptr; node = node->next) {
+                    cout << node->key << " ";
+                }
+                cout << endl;
+            }
+            return;
+        }
+        for (int s = (protectedCapacity > 0 ? 1 : 0); s >= 0; s--) {
+            cout << (s == 1 ? "Protected: " : (protectedCapacity > 0 ? "Probation: " : "Cache: "));
+            for (CacheNode<K, V>* node = front[s]; node != nullptr; node = node->next) {
+                cout << node->key << " ";
+            }
+            cout << endl;
+        }
+    }
+};
+
+// Define a ShardedLRUCache class: a thread-safe cache split into independent
+// LRUCache shards, each behind its own mutex, so threads working on different
+// keys rarely wait for each other
+template <typename K, typename V>
+class ShardedLRUCache {
+private:
+    // One shard: a cache and the lock that protects it (padded to its own cache line)
+    struct alignas(64) Shard {
+        mutex lock;
+        LRUCache<K, V> cache;
+
+        Shard(int capacity, CacheMode mode) : cache(capacity, mode) {
+        }
+    };
+
+    // The shards
+    vector<unique_ptr<Shard> > shards;
+    // Mask selecting a shard from a hash (shard count is a power of two)
+    size_t mask;
+
+    // Pick the shard responsible for a key
+    Shard& shardFor(const K& key) {
+        // Use the high bits of a multiplicative hash so they differ from the bits the shard index uses
+        uint64_t h = (uint64_t)std::hash<K>()(key) * 0x9E3779B97F4A7C15ULL;
+        return *shards[(h >> 40) & mask];
+    }
+
+public:
+    // Constructor to split the total capacity over shardCount shards (rounded up to a
+    // power of two, and down again while there would be more shards than entries)
+    ShardedLRUCache(int capacity, int shardCount = 16, CacheMode mode = PLAIN_LRU) {
+        // Round the shard count up to a power of two
+        size_t n = 1;
+        while (n < (size_t)shardCount) {
+            n <<= 1;
+        }
+        // Every shard holds at least one entry, so halve the count until they all get one
+        while (n > 1 && n > (size_t)capacity) {
+            n >>= 1;
+        }
+        mask = n - 1;
+        // Split the capacity so the shards add up to exactly the total: the
+        // remainder goes one entry each to the first shards
+        int perShard = capacity / (int)n;
+        int remainder = capacity % (int)n;
+        for (size_t i = 0; i < n; i++) {
+            int shardCapacity = perShard + ((int)i < remainder ? 1 : 0);
+            shards.push_back(unique_ptr<Shard>(new Shard(shardCapacity, mode)));
+        }
+    }
+
+    // Look up a key (thread-safe)
+    bool get(const K& key, V& out) {
+        Shard& shard = shardFor(key);
+        lock_guard<mutex> guard(shard.lock);
+        return shard.cache.get(key, out);
+    }
+
+    // Insert or update a key (thread-safe)
+    void put(const K& key, const V& value) {
+        Shard& shard = shardFor(key);
+        lock_guard<mutex> guard(shard.lock);
+        shard.cache.put(key, value);
+    }
+
+    // Remove a key (thread-safe)
+    bool erase(const K& key) {
+        Shard& shard = shardFor(key);
+        lock_guard<mutex> guard(shard.lock);
+        return shard.cache.erase(key);
+    }
+
+    // Get the hit rate over all shards
+    double hitRate() {
+        uint64_t hits = 0, lookups = 0;
+        for (size_t i = 0; i < shards.size(); i++) {
+            lock_guard<mutex> guard(shards[i]->lock);
+            hits += shards[i]->cache.getHits();
+            lookups += shards[i]->cache.getHits() + shards[i]->cache.getMisses();
+        }
+        return lookups == 0 ? 0.0 : (double)hits / lookups;
+    }
+
+    // Get the number of operations served by all shards
+    uint64_t getOperations() {
+        uint64_t operations = 0;
+        for (size_t i = 0; i < shards.size(); i++) {
+            lock_guard<mutex> guard(shards[i]->lock);
+            operations += shards[i]->cache.getOperations();
+        }
+        return operations;
+    }
+};
@@ -1,4 +1,5 @@
 #include <iostream>
+#include "../node_magazine.h"
 
 using namespace std;
 
@@ -43,8 +44,8 @@ public:
             Node* temp = front; 
             // Move front pointer to the next node
             front = front->next; 
-            // Delete the current node to free memory
-            delete temp; 
+            // Recycle the current node through the node magazines
+            NodeMagazine<Node>::destroy(temp); 
         }
     }
 
@@ -56,8 +57,8 @@ public:
 
     // Enqueue an element into the queue
     void enqueue(int element) {
-        // Create a new node with the given element
-        Node* newNode = new Node(element); 
+        // Create a new node with the given element from recycled memory
+        Node* newNode = NodeMagazine<Node>::create(element); 
         // If the queue is empty, set both front and rear to the new node
         if (isEmpty()) { 
             front = newNode; 
@@ -89,8 +90,8 @@ public:
         if (isEmpty()) { 
             rear = nullptr; 
         }
-        // Delete the old front node to free memory
-        delete temp; 
+        // Recycle the old front node through the node magazines
+        NodeMagazine<Node>::destroy(temp); 
         // Return the dequeued element
         return element; 
     }
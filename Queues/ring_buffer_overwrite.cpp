@@ -0,0 +1,180 @@
+#include <iostream>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+// Define a Slot class for one entry of the ring buffer
+class Slot {
+public:
+    // Sequence number of the slot: odd while the writer is updating it,
+    // 2 * (recordIndex + 1) once record number recordIndex is fully stored
+    atomic<uint64_t> sequence;
+    // Value stored in the slot (atomic so torn reads are impossible)
+    atomic<int> data;
+
+    // Constructor to initialize an empty slot
+    Slot() {
+        // Sequence 0 means "never written"
+        this->sequence.store(0, memory_order_relaxed);
+        // Start with a zero value
+        this->data.store(0, memory_order_relaxed);
+    }
+};
+
+// Define an OverwriteRing class: a circular buffer for a single writer that never
+// blocks and never refuses data. When full, the oldest entry is overwritten
+// (unlike Queue::enqueue in queue_circular_array.cpp, which refuses when full).
+// Any number of readers can take snapshots concurrently using per-slot
+// sequence numbers (seqlock style) without ever stalling the writer.
+class OverwriteRing {
+private:
+    // Array of slots storing the records
+    Slot* slots;
+    // Number of slots, always a power of two so wrapping is a bit mask
+    uint64_t capacity;
+    // Mask used instead of the modulo operation (capacity - 1)
+    uint64_t mask;
+    // Total number of records ever written (the next record index)
+    atomic<uint64_t> written;
+
+public:
+    // Constructor to initialize the ring with at least the requested capacity
+    OverwriteRing(int capacity) {
+        // Round the capacity up to the next power of two (minimum 1)
+        uint64_t rounded = 1;
+        while (rounded < (uint64_t)capacity) {
+            rounded <<= 1;
+        }
+        // Store the rounded capacity and the matching mask
+        this->capacity = rounded;
+        this->mask = rounded - 1;
+        // Nothing has been written yet
+        this->written.store(0, memory_order_relaxed);
+        // Dynamically allocate the slot array
+        this->slots = new Slot[rounded];
+    }
+
+    // Destructor to free memory
+    ~OverwriteRing() {
+        // Free the memory allocated for the slot array
+        delete[] slots;
+    }
+
+    // Get the number of slots in the ring
+    int getCapacity() {
+        // Return the (power of two) capacity
+        return (int)capacity;
+    }
+
+    // Get the total number of records ever written
+    uint64_t totalWritten() {
+        // Readers only need an approximate, monotonic value here
+        return written.load(memory_order_acquire);
+    }
+
+    // Record an element (must only be called from the single writer thread).
+    // Never blocks and never fails: the oldest entry is overwritten when full.
+    void record(int element) {
+        // Only the writer modifies this counter, so a relaxed load is enough
+        uint64_t index = written.load(memory_order_relaxed);
+        // Find the slot for this record by masking the index
+        Slot& slot = slots[index & mask];
+        // Mark the slot as "being written" with an odd sequence number
+        slot.sequence.store(2 * index + 1, memory_order_relaxed);
+        // Make sure the odd marker is visible before the new data
+        atomic_thread_fence(memory_order_release);
+        // Store the element itself
+        slot.data.store(element, memory_order_relaxed);
+        // Publish the slot with the even sequence number of this record
+        slot.sequence.store(2 * (index + 1), memory_order_release);
+        // Publish the new record count
+        written.store(index + 1, memory_order_release);
+    }
+
+    // Try to read the record with the given index. Returns false if that
+    // record was overwritten (or is being overwritten) while reading.
+    bool readRecord(uint64_t index, int& out) {
+        // Find the slot that holds (or held) this record
+        Slot& slot = slots[index & mask];
+        // The sequence number this record has once fully written
+        uint64_t expected = 2 * (index + 1);
+        // Read the sequence number before reading the data
+        uint64_t before = slot.sequence.load(memory_order_acquire);
+        // If the slot does not hold this record, fail immediately
+        if (before != expected) {
+            return false;
+        }
+        // Read the data
+        int value = slot.data.load(memory_order_relaxed);
+        // Make sure the data read completes before re-checking the sequence
+        atomic_thread_fence(memory_order_acquire);
+        // Read the sequence number again
+        uint64_t after = slot.sequence.load(memory_order_relaxed);
+        // If the writer touched the slot meanwhile, the value may be stale
+        if (after != expected) {
+            return false;
+        }
+        // The read is consistent
+        out = value;
+        return true;
+    }
+
+    // Take a snapshot of the last n records (oldest first) into out.
+    // Records overwritten during the snapshot are dropped from its front, so
+    // the result is always a consecutive run ending at the newest record seen.
+    // Returns the number of records copied.
+    int snapshot(int n, vector<int>& out) {
+        // Start from an empty output
+        out.clear();
+        // Read how many records exist right now
+        uint64_t end = written.load(memory_order_acquire);
+        // Never ask for more records than the ring can hold
+        uint64_t count = (uint64_t)n < capacity ? (uint64_t)n : capacity;
+        // Never ask for more records than were written
+        if (count > end) {
+            count = end;
+        }
+        // Reserve space for the worst case
+        out.reserve(count);
+        // Walk from the newest record backwards so overwrites only cut the oldest part
+        uint64_t index = end;
+        while (index > end - count) {
+            // Move to the previous record
+            index--;
+            // Try to read it
+            int value;
+            if (!readRecord(index, value)) {
+                // The writer lapped us: everything older is gone as well
+                break;
+            }
+            // Store the value (reversed for now)
+            out.push_back(value);
+        }
+        // Put the snapshot into oldest-first order
+        for (size_t i = 0, j = out.size(); i + 1 < j; i++, j--) {
+            // Swap the outermost pair of elements
+            int temp = out[i];
+            out[i] = out[j - 1];
+            out[j - 1] = temp;
+        }
+        // Return the number of records in the snapshot
+        return (int)out.size();
+    }
+
+    // Print the last records currently in the ring
+    void printRing() {
+        // Take a snapshot of the whole ring
+        vector<int> values;
+        snapshot((int)capacity, values);
+        // Print a header for the ring elements
+        cout << "Ring elements: ";
+        // Print each element from oldest to newest
+        for (size_t i = 0; i < values.size(); i++) {
+            cout << values[i] << " ";
+        }
+        // End the line after printing all elements
+        cout << endl;
+    }
+};
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <cstring>
 
 using namespace std;
 
@@ -11,14 +12,60 @@ private:
     int top; 
     // Maximum number of elements that the stack can hold
     int capacity; 
+    // Whether the stack grows instead of overflowing when it is full
+    bool growable; 
+    // Capacity the stack was created with (a growable stack never shrinks below it)
+    int minCapacity; 
+
+    // Move the elements into a newly allocated array of the given capacity
+    void resize(int newCapacity) {
+        // Allocate the new array
+        int* newArr = new int[newCapacity]; 
+        // Copy all current elements with a single memcpy
+        memcpy(newArr, arr, (top + 1) * sizeof(int)); 
+        // Free the old array
+        delete[] arr; 
+        // Switch to the new array and record its capacity
+        arr = newArr; 
+        capacity = newCapacity; 
+    }
+
+    // Shrink a growable stack once it is only a quarter full.
+    // Growing at full and shrinking at a quarter (to half) leaves a gap,
+    // so alternating push/pop at the boundary never reallocates each time.
+    void shrinkIfSparse() {
+        // Fixed-capacity stacks never shrink
+        if (!growable) {
+            return; 
+        }
+        // Halve the target while the size is at most a quarter of it, but not below
+        // the initial capacity; a large popN can drop several factors of two at once
+        int target = capacity; 
+        while (target / 2 >= minCapacity && top + 1 <= target / 4) {
+            target /= 2; 
+        }
+        // Copy the elements only once
+        if (target != capacity) {
+            resize(target); 
+        }
+    }
 
 public:
-    // Constructor to initialize the stack with the specified capacity
-    Stack(int capacity) {
+    // Constructor to initialize the stack with the specified capacity.
+    // A growable stack doubles its capacity instead of overflowing.
+    Stack(int capacity, bool growable = false) {
+        // Always keep room for at least one element
+        if (capacity < 1) {
+            capacity = 1; 
+        }
         // Set the capacity to the provided value
         this->capacity = capacity; 
         // Initialize the top index to -1 indicating an empty stack
         this->top = -1; 
+        // Remember whether the stack may grow
+        this->growable = growable; 
+        // Remember the initial capacity as the lower bound for shrinking
+        this->minCapacity = capacity; 
         // Dynamically allocate memory for the stack array
         this->arr = new int[capacity]; 
     }
@@ -41,8 +88,36 @@ public:
         return top == capacity - 1; 
     }
 
+    // Function to get the number of elements in the stack
+    int size() {
+        // The top index is one less than the number of elements
+        return top + 1; 
+    }
+
+    // Function to get the current capacity of the stack
+    int getCapacity() {
+        // Return the number of elements the array can hold right now
+        return capacity; 
+    }
+
+    // Function to make sure the stack can hold at least n elements without reallocating
+    void reserve(int n) {
+        // Only reallocate if the current array is too small
+        if (n > capacity) {
+            resize(n); 
+        }
+        // Never shrink below a reserved size
+        if (n > minCapacity) {
+            minCapacity = n; 
+        }
+    }
+
     // Function to add an element onto the stack
     void push(int element) {
+        // A growable stack doubles its capacity when it is full
+        if (growable && isFull()) {
+            resize(capacity * 2); 
+        }
         // Check if the stack is full before adding a new element
         if (isFull()) { 
             // Print error if stack is full
@@ -63,8 +138,67 @@ public:
             // Return -1 to indicate failure or throw an exception
             return -1; 
         }
-        // Return the top element and decrement the top index
-        return arr[top--]; 
+        // Take the top element and decrement the top index
+        int element = arr[top--]; 
+        // Give memory back if the stack became sparse
+        shrinkIfSparse(); 
+        // Return the popped element
+        return element; 
+    }
+
+    // Function to push count elements from values onto the stack with one memcpy.
+    // values[count - 1] ends up on top. A fixed stack pushes nothing if they do not all fit.
+    void pushN(const int* values, int count) {
+        // Nothing to do for an empty run
+        if (count <= 0) {
+            return; 
+        }
+        // Number of elements needed after the push
+        int needed = top + 1 + count; 
+        // Grow a growable stack geometrically (or straight to the needed size)
+        if (growable && needed > capacity) {
+            resize(needed > capacity * 2 ? needed : capacity * 2); 
+        }
+        // Check if there is room for the whole run
+        if (needed > capacity) { 
+            // Print error if the run does not fit
+            cout << "Stack Overflow! Cannot push " << count << " elements" << endl; 
+            // Exit the function without adding anything
+            return; 
+        }
+        // Copy the whole run above the current top
+        memcpy(arr + top + 1, values, count * sizeof(int)); 
+        // Move the top index past the new elements
+        top += count; 
+    }
+
+    // Function to pop up to count elements into out with one memcpy.
+    // out keeps stack order: out[0] is the deepest popped element and
+    // out[n - 1] is the former top. Returns the number of elements popped.
+    int popN(int* out, int count) {
+        // Check if the stack is empty before attempting to pop
+        if (isEmpty()) { 
+            // Print error if stack is empty
+            cout << "Stack Underflow! Cannot pop element" << endl; 
+            // Nothing was popped
+            return 0; 
+        }
+        // Never pop more elements than the stack holds
+        if (count > top + 1) {
+            count = top + 1; 
+        }
+        // Nothing to do for a non-positive count
+        if (count <= 0) {
+            return 0; 
+        }
+        // Copy the top count elements to the output
+        memcpy(out, arr + top + 1 - count, count * sizeof(int)); 
+        // Move the top index below the popped elements
+        top -= count; 
+        // Give memory back if the stack became sparse
+        shrinkIfSparse(); 
+        // Return the number of popped elements
+        return count; 
     }
 
     // Function to retrieve the top element without removing it
@@ -0,0 +1,332 @@
+#include <iostream>
+#include <atomic>
+#include <cstdint>
+#include "../node_magazine.h"
+
+using namespace std;
+
+// Tagged pointers keep the node address in the low 48 bits and a 16-bit
+// counter in the high 16 bits, which needs 64-bit pointers with 48-bit
+// user-space addresses (x86-64 and AArch64)
+static_assert(sizeof(void*) == 8, "EliminationStack needs 64-bit pointers");
+
+// Define a Node class for the lock-free linked list
+class Node {
+public:
+    // Data field to store the value of the node
+    int data;
+    // Pointer to the next node (atomic because a concurrent pop may read it
+    // while the node is being recycled by another thread)
+    atomic<Node*> next;
+
+    // Constructor to initialize a node
+    Node(int data) {
+        // Assign the provided value to the data field
+        this->data = data;
+        // Initialize the next pointer to nullptr
+        this->next.store(nullptr, memory_order_relaxed);
+    }
+};
+
+// Define an EliminationSlot class: one exchange point of the elimination array,
+// padded to a cache line so neighbouring slots do not share one
+class alignas(64) EliminationSlot {
+public:
+    // State in the high 32 bits (EMPTY, OFFER or TAKEN), offered value in the low 32 bits
+    atomic<uint64_t> word;
+
+    // Constructor to initialize an empty slot
+    EliminationSlot() {
+        // An all-zero word is the EMPTY state
+        this->word.store(0, memory_order_relaxed);
+    }
+};
+
+// Define an EliminationStack class: a lock-free Treiber stack (see
+// stack_lock_free.cpp) with an elimination array in front of it. When a CAS
+// on the shared top pointer fails, the thread backs off into a random slot of
+// the array instead. A push that finds a waiting pop there (or the other way
+// round) hands its value over directly, and neither touches the central stack.
+// Each thread adapts the part of the array it uses and how long it waits to
+// the contention it observes.
+//
+// Nodes are created and recycled through the calling thread's NodeMagazine,
+// so an eliminated push/pop pair touches no shared word except its slot.
+// NodeMagazine keeps node memory until the program exits, so a pop that
+// still reads the next pointer of a node recycled meanwhile reads valid
+// memory, and the tag in the top pointer makes its CAS fail.
+class EliminationStack {
+private:
+    // Tagged pointer to the top node of the stack
+    atomic<uint64_t> top;
+    // The elimination array
+    EliminationSlot* slots;
+    // Number of slots in the elimination array
+    int slotCount;
+
+    // Mask selecting the pointer bits of a tagged pointer
+    static const uint64_t POINTER_MASK = (1ULL << 48) - 1;
+    // Slot states stored in the high half of a slot word
+    static const uint64_t EMPTY = 0;
+    static const uint64_t OFFER = 1;
+    static const uint64_t TAKEN = 2;
+    // Bounds for the number of spins a thread waits in a slot
+    static const int MIN_SPINS = 16;
+    static const int MAX_SPINS = 1024;
+
+    // Result of a single attempt on the central stack
+    enum Attempt { DONE, STACK_EMPTY, CONTENDED };
+
+    // Per-thread view of the contention, adapted after every elimination attempt
+    struct Backoff {
+        // Number of slots (from the start of the array) this thread picks from
+        int range;
+        // Number of spins this thread waits for a partner
+        int spins;
+        // State of the xorshift random number generator
+        uint32_t seed;
+    };
+
+    // Get the calling thread's backoff state
+    static Backoff& backoff() {
+        // One state per thread, shared by all stacks since it models the machine's contention
+        static thread_local Backoff state = { 1, MIN_SPINS, 0 };
+        // Seed the generator from the state's address so threads pick different slots
+        if (state.seed == 0) {
+            state.seed = (uint32_t)((uintptr_t)&state >> 4) | 1;
+        }
+        return state;
+    }
+
+    // Pick a random slot index below the thread's range (capped at limit)
+    static int randomSlot(Backoff& state, int limit) {
+        // Advance the xorshift generator
+        state.seed ^= state.seed << 13;
+        state.seed ^= state.seed >> 17;
+        state.seed ^= state.seed << 5;
+        // Map the random number into the active range (it may come from a larger stack)
+        return (int)(state.seed % (uint32_t)(state.range < limit ? state.range : limit));
+    }
+
+    // Combine a node pointer and a counter into one tagged word
+    static uint64_t pack(Node* node, uint64_t tag) {
+        // Counter in the high 16 bits, address in the low 48 bits
+        return (tag << 48) | ((uint64_t)(uintptr_t)node & POINTER_MASK);
+    }
+
+    // Extract the node pointer from a tagged word
+    static Node* pointerOf(uint64_t word) {
+        // Drop the counter bits
+        return (Node*)(uintptr_t)(word & POINTER_MASK);
+    }
+
+    // Extract the counter from a tagged word
+    static uint64_t tagOf(uint64_t word) {
+        // The counter lives in the high 16 bits
+        return word >> 48;
+    }
+
+    // Combine a slot state and a value into one slot word
+    static uint64_t slotWord(uint64_t state, int value) {
+        // State in the high half, value bits in the low half
+        return (state << 32) | (uint32_t)value;
+    }
+
+    // Make one attempt to push a node onto the central stack
+    Attempt tryPush(Node* node) {
+        // Read the current top
+        uint64_t oldTop = top.load(memory_order_relaxed);
+        // Link the node to it
+        node->next.store(pointerOf(oldTop), memory_order_relaxed);
+        // A single CAS: failure means another thread got there first
+        if (top.compare_exchange_strong(oldTop, pack(node, tagOf(oldTop) + 1), memory_order_release, memory_order_relaxed)) {
+            return DONE;
+        }
+        return CONTENDED;
+    }
+
+    // Make one attempt to pop a node from the central stack
+    Attempt tryPop(Node*& node) {
+        // Read the current top
+        uint64_t oldTop = top.load(memory_order_acquire);
+        // Report an empty stack
+        node = pointerOf(oldTop);
+        if (node == nullptr) {
+            return STACK_EMPTY;
+        }
+        // Read the successor (the node may be stale; the CAS will then fail)
+        Node* next = node->next.load(memory_order_relaxed);
+        // A single CAS: failure means another thread got there first
+        if (top.compare_exchange_strong(oldTop, pack(next, tagOf(oldTop) + 1), memory_order_acquire, memory_order_relaxed)) {
+            return DONE;
+        }
+        return CONTENDED;
+    }
+
+    // Offer a value in a random slot and wait for a pop to take it
+    bool eliminatePush(int element) {
+        // Get this thread's contention estimate
+        Backoff& state = backoff();
+        // Pick a slot
+        EliminationSlot& slot = slots[randomSlot(state, slotCount)];
+        // Try to occupy an empty slot with the offer
+        uint64_t expected = slotWord(EMPTY, 0);
+        uint64_t offer = slotWord(OFFER, element);
+        if (!slot.word.compare_exchange_strong(expected, offer, memory_order_acq_rel, memory_order_relaxed)) {
+            // The slot was busy: spread out over more slots next time
+            state.range = state.range * 2 <= slotCount ? state.range * 2 : slotCount;
+            return false;
+        }
+        // Wait a bounded time for a partner
+        for (int i = 0; i < state.spins; i++) {
+            // A pop marks the slot TAKEN once it has our value
+            if (slot.word.load(memory_order_acquire) >> 32 == TAKEN) {
+                // Free the slot for the next exchange
+                slot.word.store(slotWord(EMPTY, 0), memory_order_release);
+                // Partners are around: it pays to wait a little longer
+                state.spins = state.spins * 2 <= MAX_SPINS ? state.spins * 2 : MAX_SPINS;
+                return true;
+            }
+        }
+        // Timed out: try to withdraw the offer
+        if (slot.word.compare_exchange_strong(offer, slotWord(EMPTY, 0), memory_order_acq_rel, memory_order_acquire)) {
+            // Nobody came: use fewer slots and wait less next time
+            state.range = state.range / 2 >= 1 ? state.range / 2 : 1;
+            state.spins = state.spins / 2 >= MIN_SPINS ? state.spins / 2 : MIN_SPINS;
+            return false;
+        }
+        // A pop took the value just before the withdrawal
+        slot.word.store(slotWord(EMPTY, 0), memory_order_release);
+        return true;
+    }
+
+    // Look for an offered value in a random slot and take it
+    bool eliminatePop(int& element) {
+        // Get this thread's contention estimate
+        Backoff& state = backoff();
+        // Pick a slot
+        EliminationSlot& slot = slots[randomSlot(state, slotCount)];
+        // Wait a bounded time for an offer to appear
+        for (int i = 0; i < state.spins; i++) {
+            // Read the slot
+            uint64_t word = slot.word.load(memory_order_acquire);
+            // Only an OFFER can be taken
+            if (word >> 32 == OFFER) {
+                // Claim the offer; only one pop can win
+                if (slot.word.compare_exchange_strong(word, slotWord(TAKEN, 0), memory_order_acq_rel, memory_order_relaxed)) {
+                    // The value sits in the low half of the word
+                    element = (int)(uint32_t)word;
+                    // Partners are around: it pays to wait a little longer
+                    state.spins = state.spins * 2 <= MAX_SPINS ? state.spins * 2 : MAX_SPINS;
+                    return true;
+                }
+                // Another pop won the slot: spread out over more slots next time
+                state.range = state.range * 2 <= slotCount ? state.range * 2 : slotCount;
+                return false;
+            }
+        }
+        // Nobody came: use fewer slots and wait less next time
+        state.range = state.range / 2 >= 1 ? state.range / 2 : 1;
+        state.spins = state.spins / 2 >= MIN_SPINS ? state.spins / 2 : MIN_SPINS;
+        return false;
+    }
+
+public:
+    // Constructor to initialize the stack with the given maximum number of elimination slots
+    EliminationStack(int slotCount = 16) {
+        // Always keep at least one slot
+        if (slotCount < 1) {
+            slotCount = 1;
+        }
+        // Set the top pointer to nullptr indicating an empty stack
+        this->top.store(pack(nullptr, 0), memory_order_relaxed);
+        // Allocate the elimination array
+        this->slotCount = slotCount;
+        this->slots = new EliminationSlot[slotCount];
+    }
+
+    // Destructor to free memory (no other thread may use the stack any more)
+    ~EliminationStack() {
+        // Walk the nodes still on the stack and recycle each one
+        Node* current = pointerOf(top.load(memory_order_acquire));
+        while (current != nullptr) {
+            Node* next = current->next.load(memory_order_relaxed);
+            NodeMagazine<Node>::destroy(current);
+            current = next;
+        }
+        // Free the elimination array
+        delete[] slots;
+    }
+
+    // Check if the stack is empty (only a hint while other threads are active)
+    bool isEmpty() {
+        // Return true if the top pointer is nullptr
+        return pointerOf(top.load(memory_order_acquire)) == nullptr;
+    }
+
+    // Push an element onto the stack (safe to call from any thread)
+    void push(int element) {
+        // The node is only needed for the central stack, so it is created on the first attempt there
+        Node* newNode = nullptr;
+        while (true) {
+            // First try the central stack, with a node from this thread's magazine
+            if (newNode == nullptr) {
+                newNode = NodeMagazine<Node>::create(element);
+            }
+            if (tryPush(newNode) == DONE) {
+                return;
+            }
+            // Under contention, try to hand the value to a concurrent pop
+            if (eliminatePush(element)) {
+                // The node was not needed after all: back into this thread's magazine
+                NodeMagazine<Node>::destroy(newNode);
+                return;
+            }
+        }
+    }
+
+    // Pop an element from the stack (safe to call from any thread)
+    int pop() {
+        while (true) {
+            // First try the central stack
+            Node* node;
+            Attempt attempt = tryPop(node);
+            if (attempt == DONE) {
+                // The node now belongs to this thread, so read its data
+                int element = node->data;
+                // Recycle the node through this thread's magazine instead of deleting it
+                NodeMagazine<Node>::destroy(node);
+                return element;
+            }
+            // Check if the stack was empty
+            if (attempt == STACK_EMPTY) {
+                // Print error if the stack is empty
+                cout << "Stack Underflow! Cannot pop element" << endl;
+                // Return -1 to indicate failure
+                return -1;
+            }
+            // Under contention, try to take a value from a concurrent push
+            int element;
+            if (eliminatePop(element)) {
+                return element;
+            }
+        }
+    }
+
+    // Print the stack elements (not safe while other threads modify the stack)
+    void printStack() {
+        // Temporary pointer to iterate through the stack
+        Node* temp = pointerOf(top.load(memory_order_acquire));
+        // Print a header for the stack elements
+        cout << "Stack elements: ";
+        // Traverse the stack until the end
+        while (temp != nullptr) {
+            // Print the data of the current node
+            cout << temp->data << " ";
+            // Move to the next node
+            temp = temp->next.load(memory_order_relaxed);
+        }
+        // End the line after printing all elements
+        cout << endl;
+    }
+};
@@ -0,0 +1,224 @@
+#include <iostream>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+// Tagged pointers keep the node address in the low 48 bits and a 16-bit
+// counter in the high 16 bits, which needs 64-bit pointers with 48-bit
+// user-space addresses (x86-64 and AArch64)
+static_assert(sizeof(void*) == 8, "LockFreeStack needs 64-bit pointers");
+
+// Define a Node class for the lock-free linked list
+class Node {
+public:
+    // Data field to store the value of the node
+    int data;
+    // Pointer to the next node (atomic because a concurrent pop may read it
+    // while the node is being recycled by another thread)
+    atomic<Node*> next;
+
+    // Constructor to initialize a node
+    Node(int data) {
+        // Assign the provided value to the data field
+        this->data = data;
+        // Initialize the next pointer to nullptr
+        this->next.store(nullptr, memory_order_relaxed);
+    }
+};
+
+// Define a LockFreeStack class: a Treiber stack built from the same node design
+// as stack_linked_list.cpp. The top pointer carries a 16-bit counter that is
+// bumped on every change, so a pop that read top == A cannot succeed after A
+// was popped and pushed again (the ABA problem). Popped nodes are recycled
+// through a second tagged stack instead of being deleted, so a pop that is
+// still reading an old top->next always touches valid memory.
+class LockFreeStack {
+private:
+    // Tagged pointer to the top node of the stack
+    atomic<uint64_t> top;
+    // Tagged pointer to the top of the list of recycled nodes
+    atomic<uint64_t> freeNodes;
+
+    // Mask selecting the pointer bits of a tagged pointer
+    static const uint64_t POINTER_MASK = (1ULL << 48) - 1;
+
+    // Combine a node pointer and a counter into one tagged word
+    static uint64_t pack(Node* node, uint64_t tag) {
+        // Counter in the high 16 bits, address in the low 48 bits
+        return (tag << 48) | ((uint64_t)(uintptr_t)node & POINTER_MASK);
+    }
+
+    // Extract the node pointer from a tagged word
+    static Node* pointerOf(uint64_t word) {
+        // Drop the counter bits
+        return (Node*)(uintptr_t)(word & POINTER_MASK);
+    }
+
+    // Extract the counter from a tagged word
+    static uint64_t tagOf(uint64_t word) {
+        // The counter lives in the high 16 bits
+        return word >> 48;
+    }
+
+    // Push a chain first..last onto a tagged stack with a single CAS
+    static void pushChain(atomic<uint64_t>& head, Node* first, Node* last) {
+        // Read the current head
+        uint64_t oldHead = head.load(memory_order_relaxed);
+        while (true) {
+            // Link the end of the chain to the current head
+            last->next.store(pointerOf(oldHead), memory_order_relaxed);
+            // New head is the chain start with the counter bumped
+            uint64_t newHead = pack(first, tagOf(oldHead) + 1);
+            // Publish the chain if the head did not change meanwhile
+            if (head.compare_exchange_weak(oldHead, newHead, memory_order_release, memory_order_relaxed)) {
+                return;
+            }
+        }
+    }
+
+    // Pop one node from a tagged stack, or return nullptr if it is empty
+    static Node* popNode(atomic<uint64_t>& head) {
+        // Read the current head
+        uint64_t oldHead = head.load(memory_order_acquire);
+        while (true) {
+            // Get the node on top
+            Node* node = pointerOf(oldHead);
+            // Nothing to pop from an empty stack
+            if (node == nullptr) {
+                return nullptr;
+            }
+            // Read its successor (the node may be stale; the CAS below will then fail)
+            Node* next = node->next.load(memory_order_relaxed);
+            // New head is the successor with the counter bumped
+            uint64_t newHead = pack(next, tagOf(oldHead) + 1);
+            // Detach the node if the head did not change meanwhile
+            if (head.compare_exchange_weak(oldHead, newHead, memory_order_acquire, memory_order_acquire)) {
+                return node;
+            }
+        }
+    }
+
+    // Delete every node of a (no longer shared) chain
+    static void deleteChain(Node* node) {
+        // Walk the chain and delete each node
+        while (node != nullptr) {
+            // Remember the next node before deleting the current one
+            Node* next = node->next.load(memory_order_relaxed);
+            // Delete the current node
+            delete node;
+            // Move to the next node
+            node = next;
+        }
+    }
+
+public:
+    // Constructor to initialize the stack
+    LockFreeStack() {
+        // Set the top pointer to nullptr indicating an empty stack
+        this->top.store(pack(nullptr, 0), memory_order_relaxed);
+        // Start without any recycled nodes
+        this->freeNodes.store(pack(nullptr, 0), memory_order_relaxed);
+    }
+
+    // Destructor to free memory (no other thread may use the stack any more)
+    ~LockFreeStack() {
+        // Delete the nodes still on the stack
+        deleteChain(pointerOf(top.load(memory_order_acquire)));
+        // Delete the recycled nodes
+        deleteChain(pointerOf(freeNodes.load(memory_order_acquire)));
+    }
+
+    // Check if the stack is empty (only a hint while other threads are active)
+    bool isEmpty() {
+        // Return true if the top pointer is nullptr
+        return pointerOf(top.load(memory_order_acquire)) == nullptr;
+    }
+
+    // Push an element onto the stack (safe to call from any thread)
+    void push(int element) {
+        // Reuse a recycled node if there is one
+        Node* newNode = popNode(freeNodes);
+        if (newNode == nullptr) {
+            // Otherwise create a new node
+            newNode = new Node(element);
+        }
+        // Store the element (the node is private to this thread until published)
+        newNode->data = element;
+        // Publish the node as the new top
+        pushChain(top, newNode, newNode);
+    }
+
+    // Pop an element from the stack (safe to call from any thread)
+    int pop() {
+        // Detach the top node
+        Node* node = popNode(top);
+        // Check if the stack was empty
+        if (node == nullptr) {
+            // Print error if the stack is empty
+            cout << "Stack Underflow! Cannot pop element" << endl;
+            // Return -1 to indicate failure
+            return -1;
+        }
+        // The node now belongs to this thread, so read its data
+        int element = node->data;
+        // Recycle the node instead of deleting it
+        pushChain(freeNodes, node, node);
+        // Return the popped element
+        return element;
+    }
+
+    // Detach the whole stack at once and append its elements (top first) to out.
+    // Only one successful atomic operation touches the shared top pointer.
+    // Returns the number of elements removed.
+    int popAll(vector<int>& out) {
+        // Read the current top
+        uint64_t oldTop = top.load(memory_order_acquire);
+        // Swap in an empty stack, bumping the counter so no old pop can succeed
+        while (!top.compare_exchange_weak(oldTop, pack(nullptr, tagOf(oldTop) + 1), memory_order_acquire, memory_order_acquire)) {
+        }
+        // The detached chain is now private to this thread
+        Node* first = pointerOf(oldTop);
+        // Nothing to do if the stack was empty
+        if (first == nullptr) {
+            return 0;
+        }
+        // Collect the values and find the last node of the chain
+        int count = 0;
+        Node* last = first;
+        while (true) {
+            // Store the value of the current node
+            out.push_back(last->data);
+            count++;
+            // Stop at the end of the chain
+            Node* next = last->next.load(memory_order_relaxed);
+            if (next == nullptr) {
+                break;
+            }
+            // Move to the next node
+            last = next;
+        }
+        // Recycle the whole chain with one more CAS
+        pushChain(freeNodes, first, last);
+        // Return the number of removed elements
+        return count;
+    }
+
+    // Print the stack elements (not safe while other threads modify the stack)
+    void printStack() {
+        // Temporary pointer to iterate through the stack
+        Node* temp = pointerOf(top.load(memory_order_acquire));
+        // Print a header for the stack elements
+        cout << "Stack elements: ";
+        // Traverse the stack until the end
+        while (temp != nullptr) {
+            // Print the data of the current node
+            cout << temp->data << " ";
+            // Move to the next node
+            temp = temp->next.load(memory_order_relaxed);
+        }
+        // End the line after printing all elements
+        cout << endl;
+    }
+};
@@ -0,0 +1,195 @@
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+// Define a MinMaxStack class: an array stack that answers getMin() and getMax()
+// in O(1). Two storage strategies are available:
+//  - parallel arrays: every slot also stores the minimum and maximum of the
+//    stack up to that slot (12 bytes per element, always)
+//  - changes only: the running extremes are kept on two small side stacks that
+//    only grow when a new element reaches or beats the current extreme, so
+//    pushes that leave the extremes unchanged do no extra work
+//    (4 bytes per element plus 4 bytes per recorded change)
+class MinMaxStack {
+private:
+    // Pointer to dynamically allocate memory for storing stack elements
+    int *arr;
+    // Running minimum for each slot (parallel arrays strategy only)
+    int *minArr;
+    // Running maximum for each slot (parallel arrays strategy only)
+    int *maxArr;
+    // Side stack of minimum changes (changes only strategy)
+    vector<int> minChanges;
+    // Side stack of maximum changes (changes only strategy)
+    vector<int> maxChanges;
+    // Variable to keep track of the index of the top element in the stack
+    int top;
+    // Maximum number of elements that the stack can hold
+    int capacity;
+    // True when only changes of the extremes are stored
+    bool changesOnly;
+
+public:
+    // Constructor to initialize the stack with the specified capacity and storage strategy
+    MinMaxStack(int capacity, bool changesOnly = false) {
+        // Set the capacity to the provided value
+        this->capacity = capacity;
+        // Initialize the top index to -1 indicating an empty stack
+        this->top = -1;
+        // Remember the storage strategy
+        this->changesOnly = changesOnly;
+        // Dynamically allocate memory for the stack array
+        this->arr = new int[capacity];
+        // The parallel arrays are only needed by the first strategy
+        this->minArr = changesOnly ? nullptr : new int[capacity];
+        this->maxArr = changesOnly ? nullptr : new int[capacity];
+    }
+
+    // Destructor to release dynamically allocated memory when the object is destroyed
+    ~MinMaxStack() {
+        // Free the memory allocated for the stack arrays (deleting nullptr is a no-op)
+        delete[] arr;
+        delete[] minArr;
+        delete[] maxArr;
+    }
+
+    // Function to check if the stack is empty
+    bool isEmpty() {
+        // Return true if top is -1, indicating the stack is empty
+        return top == -1;
+    }
+
+    // Function to check if the stack is full
+    bool isFull() {
+        // Return true if top index reaches the maximum capacity - 1
+        return top == capacity - 1;
+    }
+
+    // Function to add an element onto the stack
+    void push(int element) {
+        // Check if the stack is full before adding a new element
+        if (isFull()) {
+            // Print error if stack is full
+            cout << "Stack Overflow! Cannot push element " << element << endl;
+            // Exit the function without adding the element
+            return;
+        }
+        // Increment the top index and store the element at the new top position
+        arr[++top] = element;
+        if (changesOnly) {
+            // Record a new minimum only if it reaches or beats the current one
+            // (ties are recorded too, so popping one copy keeps the other)
+            if (minChanges.empty() || element <= minChanges.back()) {
+                minChanges.push_back(element);
+            }
+            // Record a new maximum only if it reaches or beats the current one
+            if (maxChanges.empty() || element >= maxChanges.back()) {
+                maxChanges.push_back(element);
+            }
+        } else {
+            // The first element is both the minimum and the maximum
+            if (top == 0) {
+                minArr[0] = element;
+                maxArr[0] = element;
+            } else {
+                // Otherwise combine the element with the extremes below it
+                minArr[top] = element < minArr[top - 1] ? element : minArr[top - 1];
+                maxArr[top] = element > maxArr[top - 1] ? element : maxArr[top - 1];
+            }
+        }
+    }
+
+    // Function to remove and return the top element from the stack
+    int pop() {
+        // Check if the stack is empty before attempting to pop
+        if (isEmpty()) {
+            // Print error if stack is empty
+            cout << "Stack Underflow! Cannot pop element" << endl;
+            // Return -1 to indicate failure or throw an exception
+            return -1;
+        }
+        // Take the top element and decrement the top index
+        int element = arr[top--];
+        if (changesOnly) {
+            // Drop the recorded minimum if this element was it
+            if (element == minChanges.back()) {
+                minChanges.pop_back();
+            }
+            // Drop the recorded maximum if this element was it
+            if (element == maxChanges.back()) {
+                maxChanges.pop_back();
+            }
+        }
+        // Return the popped element
+        return element;
+    }
+
+    // Function to retrieve the top element without removing it
+    int peek() {
+        // Check if the stack is empty before peeking
+        if (isEmpty()) {
+            // Print error if stack is empty
+            cout << "Stack is empty! Cannot peek element" << endl;
+            // Return -1 to indicate failure or throw an exception
+            return -1;
+        }
+        // Return the element at the top index without modifying the stack
+        return arr[top];
+    }
+
+    // Function to get the smallest element on the stack in O(1)
+    int getMin() {
+        // Check if the stack is empty first
+        if (isEmpty()) {
+            // Print error if stack is empty
+            cout << "Stack is empty! No minimum" << endl;
+            // Return -1 to indicate failure
+            return -1;
+        }
+        // Read the minimum from whichever structure the strategy keeps
+        return changesOnly ? minChanges.back() : minArr[top];
+    }
+
+    // Function to get the largest element on the stack in O(1)
+    int getMax() {
+        // Check if the stack is empty first
+        if (isEmpty()) {
+            // Print error if stack is empty
+            cout << "Stack is empty! No maximum" << endl;
+            // Return -1 to indicate failure
+            return -1;
+        }
+        // Read the maximum from whichever structure the strategy keeps
+        return changesOnly ? maxChanges.back() : maxArr[top];
+    }
+
+    // Function to report the bytes used per stored element by the current strategy
+    double bytesPerElement() {
+        // An empty stack has no per-element cost
+        if (isEmpty()) {
+            return 0;
+        }
+        // Number of elements on the stack
+        int count = top + 1;
+        // Parallel arrays keep three ints for every element
+        if (!changesOnly) {
+            return 3.0 * sizeof(int);
+        }
+        // Changes only keeps one int per element plus one per recorded extreme
+        return (double)sizeof(int) * (count + minChanges.size() + maxChanges.size()) / count;
+    }
+
+    // Function to print all elements in the stack
+    void printStack() {
+        // Print a header for the stack elements
+        cout << "Stack elements: ";
+        // Iterate through the stack from bottom to top
+        for (int i = 0; i <= top; i++) {
+            // Print each element in the stack
+            cout << arr[i] << " ";
+        }
+        // End the line after printing all elements
+        cout << endl;
+    }
+};
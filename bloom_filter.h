@@ -0,0 +1,198 @@
+#ifndef BLOOM_FILTER_H
+#define BLOOM_FILTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
+// Define a BlockedBloomFilter class: a compact set summary that answers
+// "definitely absent" or "maybe present" for a key. Each key sets 8 bits, one
+// in each 64-bit word of a single 64-byte block (one cache line), so a lookup
+// touches exactly one cache line. With AVX2 the 8 bits are checked with a few
+// vector instructions. Bits are never cleared, so deleted keys stay "maybe
+// present" until the owner rebuilds the filter.
+//
+// It lives in its own header because BSTree (BST/BST.cpp) and AVLTree
+// (AVL/AVL.cpp) both put it in front of their searches.
+class BlockedBloomFilter {
+private:
+    // Number of 64-bit words in a block (8 x 8 bytes = one 64-byte cache line)
+    static const int WORDS_PER_BLOCK = 8; 
+    // Rebuild once more than this percentage of the added keys have been deleted
+    static const int REBUILD_DELETE_PERCENT = 25; 
+    // Odd multipliers that derive the 8 bit positions of a key from one hash
+    static constexpr uint32_t SALT[WORDS_PER_BLOCK] = {
+        0x47b6137bU, 0x44974d91U, 0x8824ad5bU, 0xa2b7289dU, 
+        0x705495c7U, 0x2df1424bU, 0x9efc4947U, 0x5c6bfb31U
+    }; 
+
+    // The bit array: blockCount blocks of WORDS_PER_BLOCK words, 64-byte aligned
+    uint64_t* blocks; 
+    // Number of blocks
+    uint32_t blockCount; 
+    // Bits reserved per key when sizing the filter (0 while disabled)
+    int bitsPerKey; 
+    // Number of keys the filter was sized for
+    int capacity; 
+    // Keys added and deleted since the filter was last cleared
+    int added; 
+    int deleted; 
+    // Lookups of absent keys, and how many of them the filter let through
+    long long negatives; 
+    long long falsePositives; 
+
+    // Helper function to mix all bits of a key into a 64-bit hash
+    static uint64_t hash(int key) {
+        uint64_t h = (uint32_t)key; 
+        h ^= h >> 33; 
+        h *= 0xff51afd7ed558ccdULL; 
+        h ^= h >> 33; 
+        h *= 0xc4ceb9fe1a85ec53ULL; 
+        h ^= h >> 33; 
+        return h; 
+    }
+
+    // Helper function to find the block of a hash (upper 32 bits, scaled to blockCount)
+    uint64_t* blockOf(uint64_t h) const {
+        uint32_t index = (uint32_t)(((h >> 32) * blockCount) >> 32); 
+        return blocks + (size_t)index * WORDS_PER_BLOCK; 
+    }
+
+public:
+    // Constructor to create a disabled filter
+    BlockedBloomFilter() {
+        this->blocks = nullptr; 
+        this->blockCount = 0; 
+        this->bitsPerKey = 0; 
+        this->capacity = 0; 
+        this->added = 0; 
+        this->deleted = 0; 
+        this->negatives = 0; 
+        this->falsePositives = 0; 
+    }
+
+    // The bit array is owned by one filter only
+    BlockedBloomFilter(const BlockedBloomFilter&) = delete; 
+    BlockedBloomFilter& operator=(const BlockedBloomFilter&) = delete; 
+
+    // Destructor to free the bit array
+    ~BlockedBloomFilter() {
+        ::operator delete(blocks, std::align_val_t(64)); 
+    }
+
+    // Function to check whether the filter is in use
+    bool isEnabled() const {
+        return blocks != nullptr; 
+    }
+
+    // Function to clear the filter and size it for expectedKeys keys at the
+    // given bits per key; bitsPerKey <= 0 disables it
+    void reset(int bitsPerKey, int expectedKeys) {
+        // Free the old bit array
+        ::operator delete(blocks, std::align_val_t(64)); 
+        blocks = nullptr; 
+        blockCount = 0; 
+        this->bitsPerKey = (bitsPerKey > 0) ? bitsPerKey : 0; 
+        capacity = 0; 
+        added = 0; 
+        deleted = 0; 
+        // A disabled filter has no bit array
+        if (this->bitsPerKey == 0) {
+            return; 
+        }
+        // Round the number of bits up to whole blocks (at least one)
+        const int bitsPerBlock = WORDS_PER_BLOCK * 64; 
+        long long bits = (long long)(expectedKeys > 0 ? expectedKeys : 0) * this->bitsPerKey; 
+        blockCount = (uint32_t)((bits + bitsPerBlock - 1) / bitsPerBlock); 
+        if (blockCount == 0) {
+            blockCount = 1; 
+        }
+        // The rounded-up size holds a few more keys than asked for
+        capacity = (int)((long long)blockCount * bitsPerBlock / this->bitsPerKey); 
+        size_t bytes = (size_t)blockCount * WORDS_PER_BLOCK * sizeof(uint64_t); 
+        blocks = static_cast<uint64_t*>(::operator new(bytes, std::align_val_t(64))); 
+        std::memset(blocks, 0, bytes); 
+    }
+
+    // Function to clear the lookup statistics
+    void resetStatistics() {
+        negatives = 0; 
+        falsePositives = 0; 
+    }
+
+    // Function to get the bits per key the filter is sized with (0 while disabled)
+    int getBitsPerKey() const {
+        return bitsPerKey; 
+    }
+
+    // Function to add a key
+    void add(int key) {
+        uint64_t h = hash(key); 
+        uint64_t* block = blockOf(h); 
+        // Set one bit in every word of the block
+        for (int i = 0; i < WORDS_PER_BLOCK; i++) {
+            block[i] |= 1ULL << (((uint32_t)h * SALT[i]) >> 26); 
+        }
+        added++; 
+    }
+
+    // Function to check a key: false means definitely absent, true means maybe present
+    bool mayContain(int key) const {
+        uint64_t h = hash(key); 
+        const uint64_t* block = blockOf(h); 
+#ifdef __AVX2__
+        // The 8 bit positions (top 6 bits of 8 products), widened to 64 bits in two halves
+        __m256i positions = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_set1_epi32((int)(uint32_t)h), _mm256_loadu_si256((const __m256i*)SALT)), 26); 
+        __m256i one = _mm256_set1_epi64x(1); 
+        __m256i lowMask = _mm256_sllv_epi64(one, _mm256_cvtepu32_epi64(_mm256_castsi256_si128(positions))); 
+        __m256i highMask = _mm256_sllv_epi64(one, _mm256_cvtepu32_epi64(_mm256_extracti128_si256(positions, 1))); 
+        // The key may be present only if every one of its bits is set
+        return _mm256_testc_si256(_mm256_load_si256((const __m256i*)block), lowMask) 
+            && _mm256_testc_si256(_mm256_load_si256((const __m256i*)(block + 4)), highMask); 
+#else
+        // The key may be present only if every one of its bits is set
+        for (int i = 0; i < WORDS_PER_BLOCK; i++) {
+            if ((block[i] & (1ULL << (((uint32_t)h * SALT[i]) >> 26))) == 0) {
+                return false; 
+            }
+        }
+        return true; 
+#endif
+    }
+
+    // Function to note that a key was deleted (its bits stay set)
+    void noteDelete() {
+        deleted++; 
+    }
+
+    // Function to check whether the filter should be rebuilt: it holds more keys
+    // than it was sized for, or too many of its keys have been deleted
+    bool needsRebuild() const {
+        return added > capacity || (long long)deleted * 100 > (long long)added * REBUILD_DELETE_PERCENT; 
+    }
+
+    // Function to record the outcome of a lookup of an absent key
+    void recordNegative(bool passedFilter) {
+        negatives++; 
+        if (passedFilter) {
+            falsePositives++; 
+        }
+    }
+
+    // Function to get the measured false-positive rate: the share of lookups of
+    // absent keys that the filter did not reject
+    double falsePositiveRate() const {
+        return (negatives == 0) ? 0.0 : (double)falsePositives / negatives; 
+    }
+
+    // Function to get the memory used by the bit array in bytes
+    size_t memoryBytes() const {
+        return (size_t)blockCount * WORDS_PER_BLOCK * sizeof(uint64_t); 
+    }
+};
+
+#endif
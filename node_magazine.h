@@ -0,0 +1,197 @@
+#ifndef NODE_MAGAZINE_H
+#define NODE_MAGAZINE_H
+
+#include <atomic>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Define a NodeMagazine class: a node-recycling layer for any node type.
+// Every thread keeps two small "magazines" (arrays of free node slots). Nodes
+// are taken from and returned to the thread's magazines without any locking.
+// Only when both magazines are empty (or both full) does the thread trade a
+// whole magazine with the global depot, under a mutex, so the global
+// allocator and the depot lock are touched once per MAGAZINE_SIZE operations
+// at most, and not at all once the working set is warm.
+//
+// The layer is generic and lives in its own header so every linked structure
+// can use it: NodeMagazine<Node>::create(data) instead of new Node(data) and
+// NodeMagazine<Node>::destroy(node) instead of delete node. It is used by the
+// magazine stack, the linked queue and the linked lists.
+template <typename T, int MAGAZINE_SIZE = 64>
+class NodeMagazine {
+private:
+    // A magazine: a fixed-size stack of free node slots
+    struct Magazine {
+        // Raw memory for nodes that are currently unused
+        void* rounds[MAGAZINE_SIZE];
+        // Number of free slots held
+        int count;
+
+        // Constructor to initialize an empty magazine
+        Magazine() {
+            // No slots yet
+            this->count = 0;
+        }
+    };
+
+    // The global depot that stores whole magazines between threads
+    struct Depot {
+        // Lock protecting both lists
+        std::mutex lock;
+        // Magazines holding at least one free slot
+        std::vector<Magazine*> full;
+        // Magazines holding no free slots
+        std::vector<Magazine*> empty;
+
+        // Destructor to free everything once no thread can use the layer any more
+        ~Depot() {
+            // Release the memory of every cached slot and the magazines themselves
+            for (size_t i = 0; i < full.size(); i++) {
+                for (int j = 0; j < full[i]->count; j++) {
+                    ::operator delete(full[i]->rounds[j]);
+                }
+                delete full[i];
+            }
+            // Empty magazines only hold their own memory
+            for (size_t i = 0; i < empty.size(); i++) {
+                delete empty[i];
+            }
+        }
+    };
+
+    // The calling thread's pair of magazines
+    struct ThreadCache {
+        // Magazine that allocations and frees use first
+        Magazine* loaded;
+        // Backup magazine, swapped with loaded before going to the depot
+        Magazine* previous;
+
+        // Constructor to start a thread with two empty magazines
+        ThreadCache() {
+            this->loaded = new Magazine();
+            this->previous = new Magazine();
+        }
+
+        // Destructor to hand the magazines to the depot when the thread exits
+        ~ThreadCache() {
+            // Take the depot lock
+            Depot& d = depot();
+            std::lock_guard<std::mutex> guard(d.lock);
+            // Put each magazine on the list matching its contents
+            (loaded->count > 0 ? d.full : d.empty).push_back(loaded);
+            (previous->count > 0 ? d.full : d.empty).push_back(previous);
+        }
+    };
+
+    // Number of times the global allocator was called for node memory
+    static std::atomic<long>& allocatorCallCounter() {
+        static std::atomic<long> counter(0);
+        return counter;
+    }
+
+    // Get the global depot (created on first use)
+    static Depot& depot() {
+        static Depot d;
+        return d;
+    }
+
+    // Get the calling thread's magazines (created on first use)
+    static ThreadCache& cache() {
+        static thread_local ThreadCache c;
+        return c;
+    }
+
+    // Get raw memory for one node
+    static void* allocate() {
+        // Get this thread's magazines
+        ThreadCache& c = cache();
+        // Fast path: the loaded magazine has a free slot
+        if (c.loaded->count > 0) {
+            return c.loaded->rounds[--c.loaded->count];
+        }
+        // The backup magazine has free slots: swap it in
+        if (c.previous->count > 0) {
+            std::swap(c.loaded, c.previous);
+            return c.loaded->rounds[--c.loaded->count];
+        }
+        // Both magazines are empty: trade one for a full magazine from the depot
+        {
+            // Take the depot lock
+            Depot& d = depot();
+            std::lock_guard<std::mutex> guard(d.lock);
+            if (!d.full.empty()) {
+                // Park one empty magazine in the depot and load the full one
+                d.empty.push_back(c.previous);
+                c.previous = c.loaded;
+                c.loaded = d.full.back();
+                d.full.pop_back();
+                return c.loaded->rounds[--c.loaded->count];
+            }
+        }
+        // Nothing cached anywhere: fall back to the global allocator
+        allocatorCallCounter().fetch_add(1, std::memory_order_relaxed);
+        return ::operator new(sizeof(T));
+    }
+
+    // Give the memory of one node back
+    static void release(void* memory) {
+        // Get this thread's magazines
+        ThreadCache& c = cache();
+        // Fast path: the loaded magazine has room
+        if (c.loaded->count < MAGAZINE_SIZE) {
+            c.loaded->rounds[c.loaded->count++] = memory;
+            return;
+        }
+        // The backup magazine has room: swap it in
+        if (c.previous->count < MAGAZINE_SIZE) {
+            std::swap(c.loaded, c.previous);
+            c.loaded->rounds[c.loaded->count++] = memory;
+            return;
+        }
+        // Both magazines are full: hand one to the depot and get an empty one back
+        Magazine* emptyMagazine = nullptr;
+        {
+            // Take the depot lock
+            Depot& d = depot();
+            std::lock_guard<std::mutex> guard(d.lock);
+            d.full.push_back(c.previous);
+            if (!d.empty.empty()) {
+                emptyMagazine = d.empty.back();
+                d.empty.pop_back();
+            }
+        }
+        // Create a new magazine if the depot had none to spare
+        if (emptyMagazine == nullptr) {
+            emptyMagazine = new Magazine();
+        }
+        // Keep the full magazine as backup and start filling the empty one
+        c.previous = c.loaded;
+        c.loaded = emptyMagazine;
+        c.loaded->rounds[c.loaded->count++] = memory;
+    }
+
+public:
+    // Create a node from recycled memory, passing the arguments to its constructor
+    template <typename... Args>
+    static T* create(Args&&... args) {
+        // Construct the node in place
+        return new (allocate()) T(std::forward<Args>(args)...);
+    }
+
+    // Destroy a node created by create() and recycle its memory
+    static void destroy(T* node) {
+        // Run the destructor without freeing the memory
+        node->~T();
+        // Keep the memory for the next create()
+        release(node);
+    }
+
+    // Get how many times the global allocator has been called for nodes of this type
+    static long allocatorCalls() {
+        return allocatorCallCounter().load(std::memory_order_relaxed);
+    }
+};
+
+#endif